@@ -38,6 +38,11 @@ namespace config {
         bool show_inventory_weights = false; // Display weights in inventory
         bool error_beep_sound = true;        // Beep for invalid characters
         bool use_colors = true;              // Show colors
+        bool persistent_levels = false;      // Keep recently visited levels
+        bool animate_projectiles = true;     // Show bolts and thrown objects in flight
+        bool accept_final_offers = false;    // Buy and sell at the final offer, no haggling
+
+        const uint8_t ANIMATION_FRAMES_PER_SECOND = 50; // Speed of bolts and thrown objects, 0 to not show them
     } // namespace options
 
     // Dungeon generation values
@@ -57,6 +62,8 @@ namespace config {
         const uint8_t DUN_QUARTZ_TREASURE = 40; // 1/x chance of treasure per quartz
         const uint16_t DUN_UNUSUAL_ROOMS = 300; // Level/x chance of unusual room
 
+        const uint32_t LEVEL_CACHE_MAX_BYTES = 256 * 1024; // Memory for recently visited levels
+
         namespace objects {
             const uint16_t OBJ_OPEN_DOOR = 367;
             const uint16_t OBJ_CLOSED_DOOR = 368;
@@ -98,7 +105,6 @@ namespace config {
 
         // Constants describing limits of certain objects
         const uint16_t OBJECT_LAMP_MAX_CAPACITY = 15000; // Maximum amount that lamp can be filled
-        const uint8_t OBJECT_BOLTS_MAX_RANGE = 18;       // Maximum range of bolts and balls
         const uint16_t OBJECTS_RUNE_PROTECTION = 3000;   // Rune of protection resistance
 
         // definitions for objects that can be worn
@@ -163,7 +169,6 @@ namespace config {
         const uint8_t MON_MIN_PER_LEVEL = 14;             // Minimum number of monsters/level
         const uint8_t MON_MIN_TOWNSFOLK_DAY = 4;          // Number of people on town level (day)
         const uint8_t MON_MIN_TOWNSFOLK_NIGHT = 8;        // Number of people on town level (night)
-        const uint8_t MON_ENDGAME_MONSTERS = 2;           // Total number of "win" creatures
         const uint8_t MON_ENDGAME_LEVEL = 50;             // Level where winning creatures begin
         const uint8_t MON_SUMMONED_LEVEL_ADJUST = 2;      // Adjust level of summoned creatures
         const uint8_t MON_PLAYER_EXP_DRAINED_PER_HIT = 2; // Percent of player exp drained per hit
@@ -262,6 +267,7 @@ namespace config {
         const uint16_t PLAYER_REGEN_HPBASE = 1442;      // Min amount hp regen*2^16
         const uint16_t PLAYER_REGEN_MNBASE = 524;       // Min amount mana regen*2^16
         const uint8_t PLAYER_WEIGHT_CAP = 130;          // "#"*(1/10 pounds) per strength point
+        const uint8_t PLAYER_RUN_MAX_STEPS = 100;       // Steps in one run before stopping, below 255
 
         // definitions for the player's status field
         namespace status {
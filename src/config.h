@@ -36,6 +36,11 @@ namespace config {
         extern bool show_inventory_weights;
         extern bool error_beep_sound;
         extern bool use_colors;
+        extern bool persistent_levels;
+        extern bool animate_projectiles;
+        extern bool accept_final_offers;
+
+        extern const uint8_t ANIMATION_FRAMES_PER_SECOND;
     }
 
     namespace dungeon {
@@ -52,6 +57,7 @@ namespace config {
         extern const uint8_t DUN_QUARTZ_STREAMER;
         extern const uint8_t DUN_QUARTZ_TREASURE;
         extern const uint16_t DUN_UNUSUAL_ROOMS;
+        extern const uint32_t LEVEL_CACHE_MAX_BYTES;
 
         namespace objects {
             extern const uint16_t OBJ_OPEN_DOOR;
@@ -90,7 +96,7 @@ namespace config {
         extern const uint8_t OBJECT_CHANCE_SPECIAL;
         extern const uint8_t OBJECT_CHANCE_CURSED;
         extern const uint16_t OBJECT_LAMP_MAX_CAPACITY;
-        extern const uint8_t OBJECT_BOLTS_MAX_RANGE;
+        constexpr uint8_t OBJECT_BOLTS_MAX_RANGE = 18; // Maximum range of bolts and balls, needed to size DungeonPath_t
         extern const uint16_t OBJECTS_RUNE_PROTECTION;
 
         namespace flags {
@@ -153,7 +159,7 @@ namespace config {
         extern const uint8_t MON_MIN_PER_LEVEL;
         extern const uint8_t MON_MIN_TOWNSFOLK_DAY;
         extern const uint8_t MON_MIN_TOWNSFOLK_NIGHT;
-        extern const uint8_t MON_ENDGAME_MONSTERS;
+        constexpr uint8_t MON_ENDGAME_MONSTERS = 2; // Total number of "win" creatures, needed to build monster_levels[]
         extern const uint8_t MON_ENDGAME_LEVEL;
         extern const uint8_t MON_SUMMONED_LEVEL_ADJUST;
         extern const uint8_t MON_PLAYER_EXP_DRAINED_PER_HIT;
@@ -250,6 +256,7 @@ namespace config {
         extern const uint16_t PLAYER_REGEN_HPBASE;
         extern const uint16_t PLAYER_REGEN_MNBASE;
         extern const uint8_t PLAYER_WEIGHT_CAP;
+        extern const uint8_t PLAYER_RUN_MAX_STEPS;
 
         namespace status {
             extern const uint32_t PY_HUNGRY;
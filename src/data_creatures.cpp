@@ -142,7 +142,7 @@
 //  Area of affect (area_affect_radius) :  Max range that creature is able to
 //                          "notice" the player.
 
-Creature_t creatures_list[MON_MAX_CREATURES] = {
+constexpr Creature_t creatures_list[MON_MAX_CREATURES] = {
     {"Filthy Street Urchin",      0x0012000AL, 0x00000000L, 0x2034,     0,  40,  4,   1, 11, 'p', {  1,  4}, { 72, 148,   0,   0},   0, Color_Dirt},
     {"Blubbering Idiot",          0x0012000AL, 0x00000000L, 0x2030,     0,   0,  6,   1, 11, 'p', {  1,  2}, { 79,   0,   0,   0},   0, Color_Flesh},
     {"Pitiful-Looking Beggar",    0x0012000AL, 0x00000000L, 0x2030,     0,  40, 10,   1, 11, 'p', {  1,  4}, { 72,   0,   0,   0},   0, Color_Dirt},
@@ -433,6 +433,83 @@ Creature_t creatures_list[MON_MAX_CREATURES] = {
     {"Balrog",                    0xFF1F0002L, 0x0081C743L, 0x5004, 55000L,  0, 40, 125, 13, 'B', { 75, 40}, {104,  78, 214,   0}, 100, Color_Shadow_And_Flame},
 };
 
+// Monsters are picked by level, from the creatures between two
+// monster_levels[] entries, so they must be sorted by level.
+static constexpr bool creaturesSortedByLevel() {
+    for (int i = 0; i < MON_MAX_CREATURES; i++) {
+        // a missing entry has no name
+        if (creatures_list[i].name == nullptr) {
+            return false;
+        }
+
+        // the winning creatures at the end are only placed on purpose
+        if (i >= MON_MAX_CREATURES - config::monsters::MON_ENDGAME_MONSTERS) {
+            continue;
+        }
+
+        if (creatures_list[i].level > MON_MAX_LEVELS || (i > 0 && creatures_list[i].level < creatures_list[i - 1].level)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static_assert(creaturesSortedByLevel(), "creatures_list[] must have MON_MAX_CREATURES entries, sorted by level");
+
+typedef struct {
+    int16_t counts[MON_MAX_LEVELS + 1];
+} MonsterLevels_t;
+
+// monster_levels[n] is the number of creatures of level n or lower,
+// leaving out the winning creatures at the end of creatures_list[] -RAK-
+static constexpr MonsterLevels_t monsterLevelsBuild() {
+    MonsterLevels_t levels{};
+
+    for (int i = 0; i < MON_MAX_CREATURES - config::monsters::MON_ENDGAME_MONSTERS; i++) {
+        levels.counts[creatures_list[i].level]++;
+    }
+
+    for (int i = 1; i <= MON_MAX_LEVELS; i++) {
+        levels.counts[i] += levels.counts[i - 1];
+    }
+
+    return levels;
+}
+
+static constexpr MonsterLevels_t monster_levels_table = monsterLevelsBuild();
+
+int16_t const (&monster_levels)[MON_MAX_LEVELS + 1] = monster_levels_table.counts;
+
+typedef struct {
+    CreatureBehaviour_t creatures[MON_MAX_CREATURES];
+} CreatureBehaviours_t;
+
+static_assert(sizeof(CreatureBehaviour_t) == 16, "creature behaviours should stay small");
+
+static constexpr CreatureBehaviours_t creatureBehavioursBuild() {
+    CreatureBehaviours_t behaviours{};
+
+    for (int i = 0; i < MON_MAX_CREATURES; i++) {
+        Creature_t const &creature = creatures_list[i];
+        CreatureBehaviour_t &behaviour = behaviours.creatures[i];
+
+        behaviour.movement = creature.movement;
+        behaviour.spells = creature.spells;
+        behaviour.defenses = creature.defenses;
+        behaviour.sleep_counter = creature.sleep_counter;
+        behaviour.area_affect_radius = creature.area_affect_radius;
+        behaviour.speed = creature.speed;
+        behaviour.level = creature.level;
+    }
+
+    return behaviours;
+}
+
+static constexpr CreatureBehaviours_t creature_behaviours_table = creatureBehavioursBuild();
+
+CreatureBehaviour_t const (&creature_behaviours)[MON_MAX_CREATURES] = creature_behaviours_table.creatures;
+
 // ERROR: attack #35 is no longer used
 MonsterAttack_t monster_attacks[MON_ATTACK_TYPES] = {
     // 0
@@ -61,7 +61,7 @@
 // Object list (All objects must be defined here)
 
 // Dungeon items from 0 to MAX_DUNGEON_OBJECTS
-DungeonObject_t game_objects[MAX_OBJECTS_IN_GAME] = {
+static constexpr DungeonObject_t object_list[MAX_OBJECTS_IN_GAME] = {
     {"Poison",                          0x00000001L, TV_FOOD,        ',', 500,  0,    64,  1, 1,    0,  0, 0,   0, {0, 0}, 7, Color_Food}, // 0
     {"Blindness",                       0x00000002L, TV_FOOD,        ',', 500,  0,    65,  1, 1,    0,  0, 0,   0, {0, 0}, 9, Color_Food}, // 1
     {"Paranoia",                        0x00000004L, TV_FOOD,        ',', 500,  0,    66,  1, 1,    0,  0, 0,   0, {0, 0}, 9, Color_Food}, // 2
@@ -521,6 +521,126 @@ DungeonObject_t game_objects[MAX_OBJECTS_IN_GAME] = {
     {"",                              0x00000000L, TV_NOTHING,  ' ', 0, 0, 0, 0,   0, 0, 0, 0, 0, {0, 0}, 0, Color_Red}, // 419
 };
 
+// Objects are picked by level, see treasure_levels[] below, and dungeon
+// objects are no deeper than the deepest level.
+static constexpr bool objectsHaveLevels() {
+    for (int i = 0; i < MAX_OBJECTS_IN_GAME; i++) {
+        // a missing entry has no name
+        if (object_list[i].name == nullptr) {
+            return false;
+        }
+
+        if (i < MAX_DUNGEON_OBJECTS && object_list[i].depth_first_found > TREASURE_MAX_LEVELS) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static_assert(objectsHaveLevels(), "game_objects[] must have MAX_OBJECTS_IN_GAME entries, dungeon objects up to TREASURE_MAX_LEVELS deep");
+
+typedef struct {
+    DungeonObject_t objects[MAX_OBJECTS_IN_GAME];
+} DungeonObjects_t;
+
+// Adjust prices of objects, rounding half-way cases up -RAK-
+static constexpr DungeonObjects_t objectsWithAdjustedPrices() {
+    DungeonObjects_t adjusted{};
+
+    for (int i = 0; i < MAX_OBJECTS_IN_GAME; i++) {
+        adjusted.objects[i] = object_list[i];
+        adjusted.objects[i].cost = ((object_list[i].cost * COST_ADJUSTMENT) + 50) / 100;
+    }
+
+    return adjusted;
+}
+
+static constexpr DungeonObjects_t game_objects_table = objectsWithAdjustedPrices();
+
+DungeonObject_t const (&game_objects)[MAX_OBJECTS_IN_GAME] = game_objects_table.objects;
+
+typedef struct {
+    Inventory_t items[MAX_OBJECTS_IN_GAME];
+} GameObjectItems_t;
+
+// Every new item starts as a copy of one of these, see inventoryItemCopyTo()
+static constexpr GameObjectItems_t gameObjectItemsBuild() {
+    GameObjectItems_t items{};
+
+    for (int i = 0; i < MAX_OBJECTS_IN_GAME; i++) {
+        DungeonObject_t const &from = game_objects_table.objects[i];
+        Inventory_t &item = items.items[i];
+
+        item.id = (uint16_t) i;
+        item.special_name_id = SpecialNameIds::SN_NULL;
+        item.flags = from.flags;
+        item.category_id = from.category_id;
+        item.sprite = from.sprite;
+        item.misc_use = from.misc_use;
+        item.cost = from.cost;
+        item.sub_category_id = from.sub_category_id;
+        item.items_count = from.items_count;
+        item.weight = from.weight;
+        item.to_hit = from.to_hit;
+        item.to_damage = from.to_damage;
+        item.ac = from.ac;
+        item.to_ac = from.to_ac;
+        item.damage = from.damage;
+        item.depth_first_found = from.depth_first_found;
+        item.identification = 0;
+    }
+
+    return items;
+}
+
+static constexpr GameObjectItems_t game_object_items_table = gameObjectItemsBuild();
+
+Inventory_t const (&game_object_items)[MAX_OBJECTS_IN_GAME] = game_object_items_table.items;
+
+typedef struct {
+    int16_t counts[TREASURE_MAX_LEVELS + 1];
+    int16_t sorted[MAX_DUNGEON_OBJECTS];
+} TreasureLevels_t;
+
+// treasure_levels[n] is the number of dungeon objects of level n or lower,
+// and sorted_objects[] has the game_objects[] indexes sorted by level -RAK-
+static constexpr TreasureLevels_t treasureLevelsBuild() {
+    TreasureLevels_t levels{};
+
+    for (int i = 0; i < MAX_DUNGEON_OBJECTS; i++) {
+        levels.counts[object_list[i].depth_first_found]++;
+    }
+
+    for (int i = 1; i <= TREASURE_MAX_LEVELS; i++) {
+        levels.counts[i] += levels.counts[i - 1];
+    }
+
+    // this is an O(n) sort, using the counts above. It is not a stable
+    // sort, but the order must not change, as it decides which object
+    // a random number picks.
+    int indexes[TREASURE_MAX_LEVELS + 1] = {};
+    for (int i = 0; i <= TREASURE_MAX_LEVELS; i++) {
+        indexes[i] = 1;
+    }
+
+    for (int i = 0; i < MAX_DUNGEON_OBJECTS; i++) {
+        int level = object_list[i].depth_first_found;
+        int object_id = levels.counts[level] - indexes[level];
+
+        levels.sorted[object_id] = (int16_t) i;
+
+        indexes[level]++;
+    }
+
+    return levels;
+}
+
+static constexpr TreasureLevels_t treasure_levels_table = treasureLevelsBuild();
+
+int16_t const (&treasure_levels)[TREASURE_MAX_LEVELS + 1] = treasure_levels_table.counts;
+int16_t const (&sorted_objects)[MAX_DUNGEON_OBJECTS] = treasure_levels_table.sorted;
+
 const char *special_item_names[SpecialNameIds::SN_ARRAY_SIZE] = {
     CNIL,                "(R)",              "(RA)",
     "(RF)",              "(RC)",             "(RL)",
@@ -283,7 +283,7 @@ bool caveTileVisible(Coord_t const &coord) {
 // Places a particular trap at location y, x -RAK-
 void dungeonSetTrap(Coord_t const &coord, int sub_type_id) {
     int free_treasure_id = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) free_treasure_id;
+    treasurePlaceOnTile(coord, free_treasure_id);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_TRAP_LIST + sub_type_id, game.treasure.list[free_treasure_id]);
 }
 
@@ -312,7 +312,7 @@ void trapChangeVisibility(Coord_t const &coord) {
 // Places rubble at location y, x -RAK-
 void dungeonPlaceRubble(Coord_t const &coord) {
     int free_treasure_id = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) free_treasure_id;
+    treasurePlaceOnTile(coord, free_treasure_id);
     dg.floor[coord.y][coord.x].feature_id = TILE_BLOCKED_FLOOR;
     inventoryItemCopyTo(config::dungeon::objects::OBJ_RUBBLE, game.treasure.list[free_treasure_id]);
 }
@@ -331,7 +331,7 @@ void dungeonPlaceGold(Coord_t const &coord) {
         gold_type_id = config::dungeon::objects::MAX_GOLD_TYPES - 1;
     }
 
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) free_treasure_id;
+    treasurePlaceOnTile(coord, free_treasure_id);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_GOLD_LIST + gold_type_id, game.treasure.list[free_treasure_id]);
     game.treasure.list[free_treasure_id].cost += (8L * (int32_t) randomNumber((int) game.treasure.list[free_treasure_id].cost)) + randomNumber(8);
 
@@ -344,7 +344,7 @@ void dungeonPlaceGold(Coord_t const &coord) {
 void dungeonPlaceRandomObjectAt(Coord_t const &coord, bool must_be_small) {
     int free_treasure_id = popt();
 
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) free_treasure_id;
+    treasurePlaceOnTile(coord, free_treasure_id);
 
     int object_id = itemGetRandomObjectId(dg.current_level, must_be_small);
     inventoryItemCopyTo(sorted_objects[object_id], game.treasure.list[free_treasure_id]);
@@ -356,6 +356,60 @@ void dungeonPlaceRandomObjectAt(Coord_t const &coord, bool must_be_small) {
     }
 }
 
+// Random samples tried by dungeonPickRandomTile() before it counts the candidates.
+constexpr int PICK_TILE_MAX_SAMPLES = 256;
+
+// Picks a random tile for which `is_candidate()` is true, at least `border`
+// tiles in from the edge of the level. Tiles are sampled until a candidate
+// is found, but when that keeps failing - a sparse level, or most of it too
+// close to the player - the candidates are counted and one of them chosen
+// directly. Every candidate is equally likely either way.
+// Returns false if there are no candidates at all.
+bool dungeonPickRandomTile(Coord_t &coord, int border, std::function<bool(Coord_t const &)> const &is_candidate) {
+    int height = dg.height - 2 * border;
+    int width = dg.width - 2 * border;
+
+    for (int i = 0; i < PICK_TILE_MAX_SAMPLES; i++) {
+        coord.y = randomNumber(height) - 1 + border;
+        coord.x = randomNumber(width) - 1 + border;
+
+        if (is_candidate(coord)) {
+            return true;
+        }
+    }
+
+    int candidates = 0;
+    Coord_t spot = Coord_t{0, 0};
+
+    for (spot.y = border; spot.y < border + height; spot.y++) {
+        for (spot.x = border; spot.x < border + width; spot.x++) {
+            if (is_candidate(spot)) {
+                candidates++;
+            }
+        }
+    }
+
+    if (candidates == 0) {
+        return false;
+    }
+
+    int chosen = randomNumber(candidates);
+
+    for (spot.y = border; spot.y < border + height; spot.y++) {
+        for (spot.x = border; spot.x < border + width; spot.x++) {
+            if (is_candidate(spot)) {
+                chosen--;
+                if (chosen == 0) {
+                    coord = spot;
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
 // Allocates an object for tunnels and rooms -RAK-
 void dungeonAllocateAndPlaceObject(bool (*set_function)(int), int object_type, int number) {
     Coord_t coord = Coord_t{0, 0};
@@ -363,10 +417,14 @@ void dungeonAllocateAndPlaceObject(bool (*set_function)(int), int object_type, i
     for (int i = 0; i < number; i++) {
         // don't put an object beneath the player, this could cause
         // problems if player is standing under rubble, or on a trap.
-        do {
-            coord.y = randomNumber(dg.height) - 1;
-            coord.x = randomNumber(dg.width) - 1;
-        } while (!(*set_function)(dg.floor[coord.y][coord.x].feature_id) || dg.floor[coord.y][coord.x].treasure_id != 0 || (coord.y == py.pos.y && coord.x == py.pos.x));
+        bool found = dungeonPickRandomTile(coord, 0, [set_function](Coord_t const &spot) {
+            Tile_t const &tile = dg.floor[spot.y][spot.x];
+            return (*set_function)(tile.feature_id) && tile.treasure_id == 0 && (spot.y != py.pos.y || spot.x != py.pos.x);
+        });
+
+        if (!found) {
+            return;
+        }
 
         switch (object_type) {
             case 1:
@@ -439,6 +497,7 @@ void dungeonLightRoom(Coord_t const &coord) {
 
             if (tile.perma_lit_room && !tile.permanent_light) {
                 tile.permanent_light = true;
+                playerTravelTileSeen(location);
 
                 if (tile.feature_id == TILE_DARK_FLOOR) {
                     tile.feature_id = TILE_LIGHT_FLOOR;
@@ -457,6 +516,12 @@ void dungeonLightRoom(Coord_t const &coord) {
 
 // Lights up given location -RAK-
 void dungeonLiteSpot(Coord_t const &coord) {
+    PROFILE_SCOPE(DungeonLiteSpot);
+
+    if (caveTileVisible(coord)) {
+        playerTravelTileSeen(coord);
+    }
+
     if (!coordInsidePanel(coord)) {
         return;
     }
@@ -521,6 +586,7 @@ static void sub1MoveLight(Coord_t const &from, Coord_t const &to) {
             if (py.temporary_light_only) {
                 tile.temporary_light = true;
             }
+            playerTravelTileSeen(Coord_t{y, x});
 
             if (tile.feature_id >= MIN_CAVE_WALL) {
                 tile.permanent_light = true;
@@ -612,6 +678,8 @@ void dungeonDeleteMonster(int id) {
 // its ID from the dungeon level.
 // This is called in breath(), and a couple of places in creatures.c.
 void dungeonRemoveMonsterFromLevel(int id) {
+    monsterScheduleWake(id);
+
     Monster_t &monster = monsters[id];
 
     // Force the HP negative to ensure that the monster is dead. For example, if the
@@ -635,6 +703,9 @@ void dungeonDeleteMonsterRecord(int id) {
     int last_id = next_free_monster_id - 1;
     Monster_t &monster = monsters[last_id];
 
+    monsterScheduleWake(id);
+    monsterScheduleWake(last_id);
+
     if (id != last_id) {
         dg.floor[monster.pos.y][monster.pos.x].creature_id = (uint8_t) id;
         monsters[id] = monsters[last_id];
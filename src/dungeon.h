@@ -57,7 +57,8 @@ typedef struct {
 } Dungeon_t;
 
 extern Dungeon_t dg;
-extern DungeonObject_t game_objects[MAX_OBJECTS_IN_GAME];
+extern DungeonObject_t const (&game_objects)[MAX_OBJECTS_IN_GAME];
+extern Inventory_t const (&game_object_items)[MAX_OBJECTS_IN_GAME];
 
 void dungeonDisplayMap();
 
@@ -75,6 +76,7 @@ void trapChangeVisibility(Coord_t const &coord);
 void dungeonPlaceRubble(Coord_t const &coord);
 void dungeonPlaceGold(Coord_t const &coord);
 
+bool dungeonPickRandomTile(Coord_t &coord, int border, std::function<bool(Coord_t const &)> const &is_candidate);
 void dungeonPlaceRandomObjectAt(Coord_t const &coord, bool must_be_small);
 void dungeonAllocateAndPlaceObject(bool (*set_function)(int), int object_type, int number);
 void dungeonPlaceRandomObjectNear(Coord_t coord, int tries);
@@ -91,8 +93,47 @@ int dungeonSummonObject(Coord_t coord, int amount, int object_type);
 bool dungeonDeleteObject(Coord_t const &coord);
 
 // generate the dungeon
+void dungeonClearLevel();
+void dungeonNewSpot(Coord_t &coord);
 void generateCave();
 
+// level_cache.cpp
+typedef struct {
+    int16_t depth;
+    std::vector<uint8_t> data;
+} LevelSnapshot_t;
+
+void levelCacheStore(int depth);
+bool levelCacheRestore(int depth);
+void levelCacheInsert(int depth, std::vector<uint8_t> data);
+std::vector<LevelSnapshot_t> &levelCacheSnapshots();
+
 // Line of Sight
 bool los(Coord_t from, Coord_t to);
+
+// The tiles a bolt passes through going in a direction, not counting the
+// one it starts on. The first `open` of them are before any wall or closed
+// door, the rest are only reached by rays which can get past those.
+typedef struct {
+    Coord_t tiles[config::treasure::OBJECT_BOLTS_MAX_RANGE];
+    int length;
+    int open;
+} DungeonPath_t;
+
+void dungeonTracePath(Coord_t coord, int direction, DungeonPath_t &path);
+
+// Balls and breaths reach this far from where they explode
+constexpr uint8_t AREA_EFFECT_MAX_RADIUS = 2;
+constexpr uint8_t AREA_EFFECT_MAX_TILES = (2 * AREA_EFFECT_MAX_RADIUS + 1) * (2 * AREA_EFFECT_MAX_RADIUS + 1);
+
+// The tiles around the centre of an explosion, row by row.
+typedef struct {
+    Coord_t centre;
+    Coord_t tiles[AREA_EFFECT_MAX_TILES];
+    uint8_t kernel_ids[AREA_EFFECT_MAX_TILES];
+    int length;
+} DungeonArea_t;
+
+void dungeonAreaTiles(Coord_t centre, int radius, DungeonArea_t &area);
+bool dungeonAreaTileInSight(DungeonArea_t const &area, int id);
 void look();
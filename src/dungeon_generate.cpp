@@ -162,14 +162,14 @@ static void dungeonPlaceStreamerRock(uint8_t rock_type, int chance_of_treasure)
 
 static void dungeonPlaceOpenDoor(Coord_t coord) {
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_OPEN_DOOR, game.treasure.list[cur_pos]);
     dg.floor[coord.y][coord.x].feature_id = TILE_CORR_FLOOR;
 }
 
 static void dungeonPlaceBrokenDoor(Coord_t coord) {
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_OPEN_DOOR, game.treasure.list[cur_pos]);
     dg.floor[coord.y][coord.x].feature_id = TILE_CORR_FLOOR;
     game.treasure.list[cur_pos].misc_use = 1;
@@ -177,14 +177,14 @@ static void dungeonPlaceBrokenDoor(Coord_t coord) {
 
 static void dungeonPlaceClosedDoor(Coord_t coord) {
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_CLOSED_DOOR, game.treasure.list[cur_pos]);
     dg.floor[coord.y][coord.x].feature_id = TILE_BLOCKED_FLOOR;
 }
 
 static void dungeonPlaceLockedDoor(Coord_t coord) {
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_CLOSED_DOOR, game.treasure.list[cur_pos]);
     dg.floor[coord.y][coord.x].feature_id = TILE_BLOCKED_FLOOR;
     game.treasure.list[cur_pos].misc_use = (int16_t)(randomNumber(10) + 10);
@@ -192,7 +192,7 @@ static void dungeonPlaceLockedDoor(Coord_t coord) {
 
 static void dungeonPlaceStuckDoor(Coord_t coord) {
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_CLOSED_DOOR, game.treasure.list[cur_pos]);
     dg.floor[coord.y][coord.x].feature_id = TILE_BLOCKED_FLOOR;
     game.treasure.list[cur_pos].misc_use = (int16_t)(-randomNumber(10) - 10);
@@ -200,7 +200,7 @@ static void dungeonPlaceStuckDoor(Coord_t coord) {
 
 static void dungeonPlaceSecretDoor(Coord_t coord) {
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_SECRET_DOOR, game.treasure.list[cur_pos]);
     dg.floor[coord.y][coord.x].feature_id = TILE_BLOCKED_FLOOR;
 }
@@ -236,7 +236,7 @@ static void dungeonPlaceUpStairs(Coord_t coord) {
     }
 
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_UP_STAIR, game.treasure.list[cur_pos]);
 }
 
@@ -247,7 +247,7 @@ static void dungeonPlaceDownStairs(Coord_t coord) {
     }
 
     int cur_pos = popt();
-    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(coord, cur_pos);
     inventoryItemCopyTo(config::dungeon::objects::OBJ_DOWN_STAIR, game.treasure.list[cur_pos]);
 }
 
@@ -964,18 +964,12 @@ static void dungeonPlaceDoorIfNextToTwoWalls(Coord_t coord) {
 }
 
 // Returns random co-ordinates -RAK-
-static void dungeonNewSpot(Coord_t &coord) {
-    Tile_t *tile = nullptr;
-    Coord_t position = Coord_t{0, 0};
-
-    do {
-        position.y = (int32_t) randomNumber(dg.height - 2);
-        position.x = (int32_t) randomNumber(dg.width - 2);
-        tile = &dg.floor[position.y][position.x];
-    } while (tile->feature_id >= MIN_CLOSED_SPACE || tile->creature_id != 0 || tile->treasure_id != 0);
-
-    coord.y = position.y;
-    coord.x = position.x;
+void dungeonNewSpot(Coord_t &coord) {
+    // A generated level always has some empty floor
+    (void) dungeonPickRandomTile(coord, 1, [](Coord_t const &spot) {
+        Tile_t const &tile = dg.floor[spot.y][spot.x];
+        return tile.feature_id < MIN_CLOSED_SPACE && tile.creature_id == 0 && tile.treasure_id == 0;
+    });
 }
 
 // Functions to emulate the original Pascal sets
@@ -1143,7 +1137,7 @@ static void dungeonBuildStore(int store_id, Coord_t coord) {
     dg.floor[y][x].feature_id = TILE_CORR_FLOOR;
 
     int cur_pos = popt();
-    dg.floor[y][x].treasure_id = (uint8_t) cur_pos;
+    treasurePlaceOnTile(Coord_t{y, x}, cur_pos);
 
     inventoryItemCopyTo(config::dungeon::objects::OBJ_STORE_DOOR + store_id, game.treasure.list[cur_pos]);
 }
@@ -1162,6 +1156,8 @@ static void monsterLinker() {
         monster = blank_monster;
     }
     next_free_monster_id = config::monsters::MON_MIN_INDEX_ID;
+
+    monsterScheduleReset();
 }
 
 static void dungeonPlaceTownStores() {
@@ -1241,8 +1237,8 @@ static void townGeneration() {
     storeMaintenance();
 }
 
-// Generates a random dungeon level -RAK-
-void generateCave() {
+// Throws away the current level, ready for another to be made or restored.
+void dungeonClearLevel() {
     dg.panel.top = 0;
     dg.panel.bottom = 0;
     dg.panel.left = 0;
@@ -1254,6 +1250,13 @@ void generateCave() {
     treasureLinker();
     monsterLinker();
     dungeonBlankEntireCave();
+}
+
+// Generates a random dungeon level -RAK-
+void generateCave() {
+    PROFILE_SCOPE(GenerateCave);
+
+    dungeonClearLevel();
 
     // We're in the dungeon more than the town, so let's default to that -MRC-
     dg.height = MAX_HEIGHT;
@@ -23,6 +23,8 @@
 // Because this function uses (short) ints for all calculations, overflow may
 // occur if deltaX and deltaY exceed 90.
 bool los(Coord_t from, Coord_t to) {
+    PROFILE_SCOPE(Los);
+
     int delta_x = to.x - from.x;
     int delta_y = to.y - from.y;
 
@@ -175,6 +177,224 @@ bool los(Coord_t from, Coord_t to) {
     }
 }
 
+// Walks from the starting tile towards a direction, for as far as a bolt can
+// go, so the spells can work through all the tiles at once rather than
+// stepping with playerMovePosition() and checking for walls each time.
+void dungeonTracePath(Coord_t coord, int direction, DungeonPath_t &path) {
+    Coord_t const &offset = direction_offsets[direction];
+
+    path.length = 0;
+    path.open = -1;
+
+    while (path.length < config::treasure::OBJECT_BOLTS_MAX_RANGE) {
+        coord.y += offset.y;
+        coord.x += offset.x;
+
+        if (coord.y < 0 || coord.y >= dg.height || coord.x < 0 || coord.x >= dg.width) {
+            break;
+        }
+
+        if (path.open < 0 && dg.floor[coord.y][coord.x].feature_id >= MIN_CLOSED_SPACE) {
+            path.open = path.length;
+        }
+
+        path.tiles[path.length] = coord;
+        path.length++;
+    }
+
+    if (path.open < 0) {
+        path.open = path.length;
+    }
+}
+
+// A tile near the centre of an explosion, with the tiles los() looks at on the
+// way to it. Whether it can be seen only ever depends on those being open.
+typedef struct {
+    Coord_t offset;
+    int distance;
+    int blockers_count;
+    Coord_t blockers[2 * AREA_EFFECT_MAX_RADIUS];
+} AreaTile_t;
+
+struct AreaTiles {
+    AreaTile_t tiles[AREA_EFFECT_MAX_TILES];
+    int count;
+};
+
+static constexpr int areaAbs(int value) {
+    return value < 0 ? -value : value;
+}
+
+static constexpr void areaAddBlocker(AreaTile_t &tile, int y, int x) {
+    tile.blockers[tile.blockers_count].y = y;
+    tile.blockers[tile.blockers_count].x = x;
+    tile.blockers_count++;
+}
+
+// The same walk as los(), from the centre, noting the tiles instead of testing them.
+static constexpr void areaFindBlockers(AreaTile_t &tile) {
+    int delta_y = tile.offset.y;
+    int delta_x = tile.offset.x;
+
+    if (delta_x < 2 && delta_x > -2 && delta_y < 2 && delta_y > -2) {
+        return;
+    }
+
+    if (delta_x == 0) {
+        int step = delta_y < 0 ? -1 : 1;
+        for (int yy = step; yy != delta_y; yy += step) {
+            areaAddBlocker(tile, yy, 0);
+        }
+        return;
+    }
+
+    if (delta_y == 0) {
+        int step = delta_x < 0 ? -1 : 1;
+        for (int xx = step; xx != delta_x; xx += step) {
+            areaAddBlocker(tile, 0, xx);
+        }
+        return;
+    }
+
+    int scale_half = areaAbs(delta_x * delta_y);
+    int scale = scale_half << 1;
+    int x_sign = delta_x < 0 ? -1 : 1;
+    int y_sign = delta_y < 0 ? -1 : 1;
+
+    if (areaAbs(delta_x) >= areaAbs(delta_y)) {
+        int dy = delta_y * delta_y;
+        int slope = dy << 1;
+        int xx = x_sign;
+        int yy = 0;
+
+        if (dy == scale_half) {
+            yy = y_sign;
+            dy -= scale;
+        }
+
+        while (delta_x - xx != 0) {
+            areaAddBlocker(tile, yy, xx);
+
+            dy += slope;
+
+            if (dy < scale_half) {
+                xx += x_sign;
+            } else if (dy > scale_half) {
+                yy += y_sign;
+                areaAddBlocker(tile, yy, xx);
+                xx += x_sign;
+                dy -= scale;
+            } else {
+                xx += x_sign;
+                yy += y_sign;
+                dy -= scale;
+            }
+        }
+        return;
+    }
+
+    int dx = delta_x * delta_x;
+    int slope = dx << 1;
+    int yy = y_sign;
+    int xx = 0;
+
+    if (dx == scale_half) {
+        xx = x_sign;
+        dx -= scale;
+    }
+
+    while (delta_y - yy != 0) {
+        areaAddBlocker(tile, yy, xx);
+
+        dx += slope;
+
+        if (dx < scale_half) {
+            yy += y_sign;
+        } else if (dx > scale_half) {
+            xx += x_sign;
+            areaAddBlocker(tile, yy, xx);
+            yy += y_sign;
+            dx -= scale;
+        } else {
+            xx += x_sign;
+            yy += y_sign;
+            dx -= scale;
+        }
+    }
+}
+
+// Every tile within AREA_EFFECT_MAX_RADIUS of the centre, as coordDistanceBetween() measures it.
+static constexpr AreaTiles areaTilesBuild() {
+    AreaTiles area{};
+
+    for (int y = -AREA_EFFECT_MAX_RADIUS; y <= AREA_EFFECT_MAX_RADIUS; y++) {
+        for (int x = -AREA_EFFECT_MAX_RADIUS; x <= AREA_EFFECT_MAX_RADIUS; x++) {
+            int dy = areaAbs(y);
+            int dx = areaAbs(x);
+            int distance = (((dy + dx) << 1) - (dy > dx ? dx : dy)) >> 1;
+
+            if (distance > AREA_EFFECT_MAX_RADIUS) {
+                continue;
+            }
+
+            AreaTile_t &tile = area.tiles[area.count];
+            tile.offset.y = y;
+            tile.offset.x = x;
+            tile.distance = distance;
+            areaFindBlockers(tile);
+
+            area.count++;
+        }
+    }
+
+    return area;
+}
+
+static constexpr AreaTiles area_tiles = areaTilesBuild();
+
+static_assert(area_tiles.count == 21, "a radius of 2 covers a 5x5 square without its corners");
+
+// Finds the tiles within a radius of the centre, in the same order as
+// looping over the rows and columns around it.
+void dungeonAreaTiles(Coord_t centre, int radius, DungeonArea_t &area) {
+    area.centre = centre;
+    area.length = 0;
+
+    for (int id = 0; id < area_tiles.count; id++) {
+        AreaTile_t const &tile = area_tiles.tiles[id];
+
+        if (tile.distance > radius) {
+            continue;
+        }
+
+        Coord_t coord = Coord_t{centre.y + tile.offset.y, centre.x + tile.offset.x};
+
+        if (!coordInBounds(coord)) {
+            continue;
+        }
+
+        area.tiles[area.length] = coord;
+        area.kernel_ids[area.length] = (uint8_t) id;
+        area.length++;
+    }
+}
+
+// Same as los(area.centre, area.tiles[id]), without walking the line again.
+// It is asked for as an explosion goes, as acid can melt a door in the way.
+bool dungeonAreaTileInSight(DungeonArea_t const &area, int id) {
+    AreaTile_t const &tile = area_tiles.tiles[area.kernel_ids[id]];
+
+    for (int i = 0; i < tile.blockers_count; i++) {
+        Coord_t const &blocker = tile.blockers[i];
+
+        if (dg.floor[area.centre.y + blocker.y][area.centre.x + blocker.x].feature_id >= MIN_CLOSED_SPACE) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /*
   An enhanced look, with peripheral vision. Looking all 8 -CJS- directions will
   see everything which ought to be visible. Can specify direction 5, which looks
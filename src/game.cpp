@@ -79,6 +79,20 @@ int randomNumberNormalDistribution(int mean, int standard) {
         return mean + offset;
     }
 
+    // normal_table is based on SD of 64, so adjust the
+    // index value here, round the half way case up.
+    int offset = ((standard * normalTableIndex(tmp)) + (NORMAL_TABLE_SD >> 1)) / NORMAL_TABLE_SD;
+
+    // one half should be negative
+    if (randomNumber(2) == 1) {
+        offset = -offset;
+    }
+
+    return mean + offset;
+}
+
+// Index of the normal_table[] entry for a random number from 1 to SHRT_MAX - 1
+int normalTableIndex(int tmp) {
     // binary search normal normal_table to get index that
     // matches tmp this takes up to 8 iterations.
     int low = 0;
@@ -104,16 +118,7 @@ int randomNumberNormalDistribution(int mean, int standard) {
         iindex = iindex + 1;
     }
 
-    // normal_table is based on SD of 64, so adjust the
-    // index value here, round the half way case up.
-    int offset = ((standard * iindex) + (NORMAL_TABLE_SD >> 1)) / NORMAL_TABLE_SD;
-
-    // one half should be negative
-    if (randomNumber(2) == 1) {
-        offset = -offset;
-    }
-
-    return mean + offset;
+    return iindex;
 }
 
 static struct {
@@ -132,6 +137,9 @@ static struct {
     {"Beep for invalid character", &config::options::error_beep_sound},
     {"Display rest/repeat counts", &config::options::display_counts},
     {"Show colors", &config::options::use_colors},
+    {"Keep recently visited levels", &config::options::persistent_levels},
+    {"Animate bolts and thrown objects", &config::options::animate_projectiles},
+    {"Stores: accept final offers", &config::options::accept_final_offers},
     {nullptr, nullptr},
 };
 
@@ -328,8 +336,10 @@ bool getAllDirections(const char *prompt, int &direction) {
 
 // Restore the terminal and exit
 void exitProgram() {
+    replayCheckpoint();
     flushInputBuffer();
     terminalRestore();
+    profilePrintReport();
     exit(0);
 }
 
@@ -59,6 +59,7 @@ typedef struct Game_t {
     struct {
         int16_t current_id = 0; // Current treasure heap ptr
         Inventory_t list[LEVEL_MAX_OBJECTS]{};
+        Coord_t positions[LEVEL_MAX_OBJECTS]{}; // Tile each record was last placed on
     } treasure;
 
     // Keep track of the state of the current screen (inventory, equipment, help, etc.).
@@ -73,15 +74,16 @@ typedef struct Game_t {
 
 extern Game_t game;
 
-extern int16_t sorted_objects[MAX_DUNGEON_OBJECTS];
+extern int16_t const (&sorted_objects)[MAX_DUNGEON_OBJECTS];
 extern uint16_t normal_table[NORMAL_TABLE_SIZE];
-extern int16_t treasure_levels[TREASURE_MAX_LEVELS + 1];
+extern int16_t const (&treasure_levels)[TREASURE_MAX_LEVELS + 1];
 
 void seedsInitialize(uint32_t seed);
 void seedSet(uint32_t seed);
 void seedResetToOldSeed();
 int randomNumber(int max);
 int randomNumberNormalDistribution(int mean, int standard);
+int normalTableIndex(int tmp);
 void setGameOptions();
 bool validGameVersion(uint8_t major, uint8_t minor, uint8_t patch);
 bool isCurrentGameVersion(uint8_t major, uint8_t minor, uint8_t patch);
@@ -96,8 +98,14 @@ void abortProgram(const char *msg);
 // game object management
 int popt();
 void pusht(uint8_t treasure_id);
+void treasurePlaceOnTile(Coord_t const &coord, int treasure_id);
 int itemGetRandomObjectId(int level, bool must_be_small);
 
+// level_tables.cpp
+void levelTablesInitialize();
+int levelTablesPickObject(int level, bool must_be_small);
+int levelTablesPickMonster(int level);
+
 // game files
 bool initializeScoreFile();
 void displaySplashScreen();
@@ -113,7 +121,20 @@ void endGame();
 bool saveGame();
 bool loadGame(bool &generate);
 void setFileptr(FILE *file);
+void levelSnapshotWrite(std::vector<uint8_t> &data);
+bool levelSnapshotRead(std::vector<uint8_t> const &data);
 
 // game_run.cpp
 // (includes the playDungeon() main game loop)
 void startMoria(int seed, bool start_new_game);
+
+// game_replay.cpp
+bool replayRecordStart(const std::string &filename, uint32_t seed);
+bool replayPlaybackStart(const std::string &filename, uint32_t &seed);
+bool replayIsPlaying();
+bool replayReadKey(int &key);
+void replayWriteKey(int key);
+bool replayReadKeyPress(int &result);
+void replayWriteKeyPress(int result);
+uint32_t replayGameChecksum();
+void replayCheckpoint();
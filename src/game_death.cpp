@@ -120,6 +120,7 @@ static void kingly() {
 // What happens upon dying -RAK-
 // Handles the gravestone and top-twenty routines -RAK-
 void endGame() {
+    replayCheckpoint();
     printMessage(CNIL);
 
     // flush all input
@@ -42,7 +42,9 @@ void displaySplashScreen() {
 void displayTextHelpFile(const std::string &filename) {
     FILE *file = fopen(filename.c_str(), "r");
     if (file == nullptr) {
-        putStringClearToEOL("Can not find help file '" + filename + "'.", Coord_t{0, 0});
+        vtype_t msg = {'\0'};
+        (void) snprintf(msg, MORIA_MESSAGE_SIZE, "Can not find help file '%s'.", filename.c_str());
+        putStringClearToEOL(msg, Coord_t{0, 0});
         return;
     }
 
@@ -75,7 +77,9 @@ void displayTextHelpFile(const std::string &filename) {
 void displayDeathFile(const std::string &filename) {
     FILE *file = fopen(filename.c_str(), "r");
     if (file == nullptr) {
-        putStringClearToEOL("Can not find help file '" + filename + "'.", Coord_t{0, 0});
+        vtype_t msg = {'\0'};
+        (void) snprintf(msg, MORIA_MESSAGE_SIZE, "Can not find help file '%s'.", filename.c_str());
+        putStringClearToEOL(msg, Coord_t{0, 0});
         return;
     }
 
@@ -7,9 +7,6 @@
 
 #include "headers.h"
 
-int16_t sorted_objects[MAX_DUNGEON_OBJECTS];
-int16_t treasure_levels[TREASURE_MAX_LEVELS + 1];
-
 // If too many objects on floor level, delete some of them-RAK-
 static void compactObjects() {
     printMessage("Compacting objects...");
@@ -79,16 +76,16 @@ int popt() {
 // `dungeonDeleteObject()` should always be called instead, unless the object
 // in question is not in the dungeon, e.g. in store1.c and files.c
 void pusht(uint8_t treasure_id) {
-    if (treasure_id != game.treasure.current_id - 1) {
-        game.treasure.list[treasure_id] = game.treasure.list[game.treasure.current_id - 1];
-
-        // must change the treasure_id in the cave of the object just moved
-        for (int y = 0; y < dg.height; y++) {
-            for (int x = 0; x < dg.width; x++) {
-                if (dg.floor[y][x].treasure_id == game.treasure.current_id - 1) {
-                    dg.floor[y][x].treasure_id = treasure_id;
-                }
-            }
+    int last_id = game.treasure.current_id - 1;
+
+    if (treasure_id != last_id) {
+        game.treasure.list[treasure_id] = game.treasure.list[last_id];
+
+        // must change the treasure_id in the cave of the object just moved,
+        // unless it is not in the dungeon, e.g. a store item being created
+        Coord_t coord = game.treasure.positions[last_id];
+        if (dg.floor[coord.y][coord.x].treasure_id == last_id) {
+            treasurePlaceOnTile(coord, treasure_id);
         }
     }
     game.treasure.current_id--;
@@ -96,9 +93,16 @@ void pusht(uint8_t treasure_id) {
     inventoryItemCopyTo(config::dungeon::objects::OBJ_NOTHING, game.treasure.list[game.treasure.current_id]);
 }
 
+// Puts a treasure record on the given tile. The tile is remembered,
+// so pusht() can find it again without searching the whole level.
+void treasurePlaceOnTile(Coord_t const &coord, int treasure_id) {
+    dg.floor[coord.y][coord.x].treasure_id = (uint8_t) treasure_id;
+    game.treasure.positions[treasure_id] = coord;
+}
+
 // Item too large to fit in chest? -DJG-
 // Use a DungeonObject_t since the item has not yet been created
-static bool itemBiggerThanChest(DungeonObject_t const &obj) {
+bool itemBiggerThanChest(DungeonObject_t const &obj) {
     switch (obj.category_id) {
         case TV_CHEST:
         case TV_BOW:
@@ -122,50 +126,10 @@ int itemGetRandomObjectId(int level, bool must_be_small) {
         return randomNumber(treasure_levels[0]) - 1;
     }
 
-    if (level >= TREASURE_MAX_LEVELS) {
+    if (level > TREASURE_MAX_LEVELS) {
         level = TREASURE_MAX_LEVELS;
-    } else if (randomNumber(config::treasure::TREASURE_CHANCE_OF_GREAT_ITEM) == 1) {
-        level = level * TREASURE_MAX_LEVELS / randomNumber(TREASURE_MAX_LEVELS) + 1;
-        if (level > TREASURE_MAX_LEVELS) {
-            level = TREASURE_MAX_LEVELS;
-        }
     }
 
-    int object_id;
-
-    // This code has been added to make it slightly more likely to get the
-    // higher level objects.  Originally a uniform distribution over all
-    // objects less than or equal to the dungeon level. This distribution
-    // makes a level n objects occur approx 2/n% of the time on level n,
-    // and 1/2n are 0th level.
-    do {
-        if (randomNumber(2) == 1) {
-            object_id = randomNumber(treasure_levels[level]) - 1;
-        } else {
-            // Choose three objects, pick the highest level.
-            object_id = randomNumber(treasure_levels[level]) - 1;
-
-            int j = randomNumber(treasure_levels[level]) - 1;
-
-            if (object_id < j) {
-                object_id = j;
-            }
-
-            j = randomNumber(treasure_levels[level]) - 1;
-
-            if (object_id < j) {
-                object_id = j;
-            }
-
-            int found_level = game_objects[sorted_objects[object_id]].depth_first_found;
-
-            if (found_level == 0) {
-                object_id = randomNumber(treasure_levels[0]) - 1;
-            } else {
-                object_id = randomNumber(treasure_levels[found_level] - treasure_levels[found_level - 1]) - 1 + treasure_levels[found_level - 1];
-            }
-        }
-    } while (must_be_small && itemBiggerThanChest(game_objects[sorted_objects[object_id]]));
-
-    return object_id;
+    // See level_tables.cpp for how likely each object is
+    return levelTablesPickObject(level, must_be_small);
 }
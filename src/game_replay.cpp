@@ -0,0 +1,373 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Record the player's key presses, and replay them to verify a game plays out the same
+
+#include "headers.h"
+
+// A game is fully determined by its seed and the keys pressed by the player,
+// so a key log holds just those, followed by a checksum of the game state
+// taken when the game ended. Replaying the log with the same seed must result
+// in the same checksum, otherwise something has changed the game logic.
+//
+// Log format: the magic string, the seed and whether wizard mode was
+// requested, followed by a series of events:
+//
+//   'K' <key>       a key returned by getKeyInput()
+//   'E'             end of input seen by getKeyInput()
+//   'N' <result>    result of checkForNonBlockingKeyPress(): 0 = none, 1 = key, 2 = EOF
+//   'C' <checksum>  state of the game when it ended
+static const char replay_magic[] = "UMKEY1\n";
+
+constexpr int REPLAY_EVENT_KEY = 'K';
+constexpr int REPLAY_EVENT_EOF = 'E';
+constexpr int REPLAY_EVENT_KEY_PRESS = 'N';
+constexpr int REPLAY_EVENT_CHECKSUM = 'C';
+
+enum class ReplayMode {
+    Off,
+    Recording,
+    Playing,
+};
+
+static ReplayMode replay_mode = ReplayMode::Off;
+static FILE *replay_file = nullptr;
+static uint32_t replay_events = 0;
+
+static void replayFinish(bool matched, const char *reason);
+
+static void writeLong(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        (void) putc((int) ((value >> (8 * i)) & 0xFF), replay_file);
+    }
+}
+
+static bool readLong(uint32_t &value) {
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+        int byte = getc(replay_file);
+        if (byte == EOF) {
+            return false;
+        }
+        value |= (uint32_t) byte << (8 * i);
+    }
+    return true;
+}
+
+// Start recording keys to `filename` for a new game started with `seed`.
+bool replayRecordStart(const std::string &filename, uint32_t seed) {
+    replay_file = fopen(filename.c_str(), "wb");
+    if (replay_file == nullptr) {
+        return false;
+    }
+
+    (void) fwrite(replay_magic, 1, sizeof(replay_magic) - 1, replay_file);
+    writeLong(seed);
+    (void) putc(game.to_be_wizard ? 1 : 0, replay_file);
+
+    replay_mode = ReplayMode::Recording;
+
+    return true;
+}
+
+// Open a key log for replay, returning the seed the game was recorded with.
+// Wizard mode is also restored, as it changes which prompts are shown.
+bool replayPlaybackStart(const std::string &filename, uint32_t &seed) {
+    replay_file = fopen(filename.c_str(), "rb");
+    if (replay_file == nullptr) {
+        return false;
+    }
+
+    char magic[sizeof(replay_magic)] = {'\0'};
+    if (fread(magic, 1, sizeof(replay_magic) - 1, replay_file) != sizeof(replay_magic) - 1 || strcmp(magic, replay_magic) != 0 || !readLong(seed)) {
+        (void) fclose(replay_file);
+        replay_file = nullptr;
+        return false;
+    }
+
+    int wizard = getc(replay_file);
+    if (wizard == EOF) {
+        (void) fclose(replay_file);
+        replay_file = nullptr;
+        return false;
+    }
+
+    game.to_be_wizard = wizard != 0;
+
+    replay_mode = ReplayMode::Playing;
+
+    return true;
+}
+
+bool replayIsPlaying() {
+    return replay_mode == ReplayMode::Playing;
+}
+
+// Reads the next event from the log, which must be of the `expected` type,
+// otherwise the game has gone off script and the replay ends.
+static int replayReadEvent(int expected) {
+    int event = getc(replay_file);
+
+    if (event == EOF) {
+        replayFinish(false, "the key log ended while the game was still waiting for input");
+    }
+
+    if (event == REPLAY_EVENT_EOF && expected == REPLAY_EVENT_KEY) {
+        return EOF;
+    }
+
+    if (event != expected) {
+        replayFinish(false, "the game asked for input in a different place to the recording");
+    }
+
+    replay_events++;
+
+    int value = getc(replay_file);
+    if (value == EOF) {
+        replayFinish(false, "the key log is truncated");
+    }
+
+    return value;
+}
+
+// When replaying, fills `key` with the next recorded key press (or EOF)
+// and returns true. Returns false when not replaying.
+bool replayReadKey(int &key) {
+    if (replay_mode != ReplayMode::Playing) {
+        return false;
+    }
+
+    key = replayReadEvent(REPLAY_EVENT_KEY);
+
+    return true;
+}
+
+void replayWriteKey(int key) {
+    if (replay_mode != ReplayMode::Recording) {
+        return;
+    }
+
+    if (key == EOF) {
+        (void) putc(REPLAY_EVENT_EOF, replay_file);
+    } else {
+        (void) putc(REPLAY_EVENT_KEY, replay_file);
+        (void) putc((uint8_t) key, replay_file);
+    }
+}
+
+// When replaying, fills `result` with the recorded outcome of a non-blocking
+// key check and returns true. Returns false when not replaying.
+bool replayReadKeyPress(int &result) {
+    if (replay_mode != ReplayMode::Playing) {
+        return false;
+    }
+
+    result = replayReadEvent(REPLAY_EVENT_KEY_PRESS);
+
+    return true;
+}
+
+void replayWriteKeyPress(int result) {
+    if (replay_mode != ReplayMode::Recording) {
+        return;
+    }
+
+    (void) putc(REPLAY_EVENT_KEY_PRESS, replay_file);
+    (void) putc(result, replay_file);
+}
+
+//
+// Game state checksum (FNV-1a)
+//
+
+static uint32_t hashValue(uint32_t hash, int32_t value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (uint32_t) (value >> (8 * i)) & 0xFF;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t hashItem(uint32_t hash, Inventory_t const &item) {
+    hash = hashValue(hash, item.id);
+    hash = hashValue(hash, item.special_name_id);
+    hash = hashValue(hash, (int32_t) item.flags);
+    hash = hashValue(hash, item.category_id);
+    hash = hashValue(hash, item.sub_category_id);
+    hash = hashValue(hash, item.misc_use);
+    hash = hashValue(hash, item.cost);
+    hash = hashValue(hash, item.items_count);
+    hash = hashValue(hash, item.weight);
+    hash = hashValue(hash, item.to_hit);
+    hash = hashValue(hash, item.to_damage);
+    hash = hashValue(hash, item.ac);
+    hash = hashValue(hash, item.to_ac);
+    hash = hashValue(hash, item.damage.dice);
+    hash = hashValue(hash, item.damage.sides);
+    hash = hashValue(hash, item.depth_first_found);
+    hash = hashValue(hash, item.identification);
+    return hash;
+}
+
+static uint32_t hashPlayer(uint32_t hash) {
+    // The name and date of birth are left out, they may
+    // come from the system rather than from the game.
+    hash = hashValue(hash, py.misc.au);
+    hash = hashValue(hash, py.misc.max_exp);
+    hash = hashValue(hash, py.misc.exp);
+    hash = hashValue(hash, py.misc.exp_fraction);
+    hash = hashValue(hash, py.misc.level);
+    hash = hashValue(hash, py.misc.max_dungeon_depth);
+    hash = hashValue(hash, py.misc.mana);
+    hash = hashValue(hash, py.misc.max_hp);
+    hash = hashValue(hash, py.misc.current_mana);
+    hash = hashValue(hash, py.misc.current_mana_fraction);
+    hash = hashValue(hash, py.misc.current_hp);
+    hash = hashValue(hash, py.misc.current_hp_fraction);
+    hash = hashValue(hash, py.misc.ac);
+    hash = hashValue(hash, py.misc.magical_ac);
+    hash = hashValue(hash, py.misc.plusses_to_hit);
+    hash = hashValue(hash, py.misc.plusses_to_damage);
+    hash = hashValue(hash, py.misc.class_id);
+    hash = hashValue(hash, py.misc.race_id);
+
+    for (int i = 0; i < 6; i++) {
+        hash = hashValue(hash, py.stats.max[i]);
+        hash = hashValue(hash, py.stats.current[i]);
+        hash = hashValue(hash, py.stats.modified[i]);
+        hash = hashValue(hash, py.stats.used[i]);
+    }
+
+    hash = hashValue(hash, (int32_t) py.flags.status);
+    hash = hashValue(hash, py.flags.rest);
+    hash = hashValue(hash, py.flags.blind);
+    hash = hashValue(hash, py.flags.paralysis);
+    hash = hashValue(hash, py.flags.confused);
+    hash = hashValue(hash, py.flags.food);
+    hash = hashValue(hash, py.flags.speed);
+    hash = hashValue(hash, py.flags.fast);
+    hash = hashValue(hash, py.flags.slow);
+    hash = hashValue(hash, py.flags.afraid);
+    hash = hashValue(hash, py.flags.poisoned);
+    hash = hashValue(hash, py.flags.image);
+    hash = hashValue(hash, py.flags.word_of_recall);
+    hash = hashValue(hash, (int32_t) py.flags.spells_learnt);
+    hash = hashValue(hash, (int32_t) py.flags.spells_worked);
+    hash = hashValue(hash, (int32_t) py.flags.spells_forgotten);
+
+    hash = hashValue(hash, py.pos.y);
+    hash = hashValue(hash, py.pos.x);
+    hash = hashValue(hash, py.pack.unique_items);
+    hash = hashValue(hash, py.pack.weight);
+    hash = hashValue(hash, py.equipment_count);
+
+    for (auto &item : py.inventory) {
+        hash = hashItem(hash, item);
+    }
+
+    return hash;
+}
+
+static uint32_t hashDungeon(uint32_t hash) {
+    hash = hashValue(hash, dg.height);
+    hash = hashValue(hash, dg.width);
+    hash = hashValue(hash, dg.game_turn);
+    hash = hashValue(hash, dg.current_level);
+
+    for (int y = 0; y < dg.height; y++) {
+        for (int x = 0; x < dg.width; x++) {
+            Tile_t const &tile = dg.floor[y][x];
+
+            int32_t flags = (int32_t) tile.perma_lit_room | (int32_t) tile.field_mark << 1 | (int32_t) tile.permanent_light << 2 | (int32_t) tile.temporary_light << 3;
+
+            hash = hashValue(hash, tile.creature_id | tile.treasure_id << 8 | tile.feature_id << 16 | flags << 24);
+        }
+    }
+
+    for (int id = 0; id < game.treasure.current_id; id++) {
+        hash = hashItem(hash, game.treasure.list[id]);
+    }
+
+    return hash;
+}
+
+static uint32_t hashMonsters(uint32_t hash) {
+    hash = hashValue(hash, next_free_monster_id);
+
+    for (int id = 0; id < next_free_monster_id; id++) {
+        Monster_t const &monster = monsters[id];
+
+        hash = hashValue(hash, monster.hp);
+        hash = hashValue(hash, monster.sleep_count);
+        hash = hashValue(hash, monster.speed);
+        hash = hashValue(hash, monster.creature_id);
+        hash = hashValue(hash, monster.pos.y);
+        hash = hashValue(hash, monster.pos.x);
+        hash = hashValue(hash, monster.stunned_amount);
+        hash = hashValue(hash, monster.confused_amount);
+    }
+
+    return hash;
+}
+
+// Checksum of the player, dungeon and monsters, plus the RNG state.
+uint32_t replayGameChecksum() {
+    uint32_t hash = 2166136261u;
+
+    hash = hashPlayer(hash);
+    hash = hashDungeon(hash);
+    hash = hashMonsters(hash);
+    hash = hashValue(hash, (int32_t) getRandomSeed());
+
+    return hash;
+}
+
+static void replayFinish(bool matched, const char *reason) {
+    (void) fclose(replay_file);
+    replay_file = nullptr;
+    replay_mode = ReplayMode::Off;
+
+    terminalRestore();
+    profilePrintReport();
+
+    if (matched) {
+        printf("Replay OK: %u events, checksum %08x\n", replay_events, replayGameChecksum());
+        exit(0);
+    }
+
+    printf("Replay FAILED after %u events: %s\n", replay_events, reason);
+    printf("Checksum at the point of failure: %08x\n", replayGameChecksum());
+    exit(1);
+}
+
+// Called once the game has finished - the character has died, been saved,
+// or the program is exiting. A recording stores the game checksum and is
+// closed, while a replay compares against it and exits.
+void replayCheckpoint() {
+    if (replay_mode == ReplayMode::Recording) {
+        (void) putc(REPLAY_EVENT_CHECKSUM, replay_file);
+        writeLong(replayGameChecksum());
+
+        (void) fclose(replay_file);
+        replay_file = nullptr;
+        replay_mode = ReplayMode::Off;
+        return;
+    }
+
+    if (replay_mode != ReplayMode::Playing) {
+        return;
+    }
+
+    uint32_t expected = 0;
+    if (getc(replay_file) != REPLAY_EVENT_CHECKSUM || !readLong(expected)) {
+        replayFinish(false, "the game ended before the recording did");
+    }
+
+    if (expected != replayGameChecksum()) {
+        replayFinish(false, "the game state checksum does not match the recording");
+    }
+
+    replayFinish(true, "");
+}
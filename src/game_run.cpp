@@ -10,9 +10,6 @@
 static void playDungeon();
 
 static void initializeCharacterInventory();
-static void initializeMonsterLevels();
-static void initializeTreasureLevels();
-static void priceAdjust();
 static char originalCommands(char command);
 static void doCommand(char command);
 static bool validCountCommand(char command);
@@ -30,17 +27,14 @@ void startMoria(int seed, bool start_new_game) {
     // setting in the game save file.
     config::options::use_roguelike_keys = false;
 
-    priceAdjust();
-
     // Show the game splash screen
     displaySplashScreen();
 
     // Grab a random seed from the clock
     seedsInitialize(static_cast<uint32_t>(seed));
 
-    // Init monster and treasure levels for allocate
-    initializeMonsterLevels();
-    initializeTreasureLevels();
+    // Init monster and object tables for allocate
+    levelTablesInitialize();
 
     // Init the store inventories
     storeInitializeOwners();
@@ -129,6 +123,10 @@ void startMoria(int seed, bool start_new_game) {
         generateCave();
     }
 
+    // Depth of the level the player is on, which dg.current_level no
+    // longer holds once they take the stairs
+    int level_depth = dg.current_level;
+
     // Loop till dead, or exit
     while (!game.character_is_dead) {
         // Dungeon logic
@@ -148,7 +146,15 @@ void startMoria(int seed, bool start_new_game) {
 
         // New level if not dead
         if (!game.character_is_dead) {
-            generateCave();
+            if (dg.current_level != level_depth) {
+                levelCacheStore(level_depth);
+            }
+
+            if (!levelCacheRestore(dg.current_level)) {
+                generateCave();
+            }
+
+            level_depth = dg.current_level;
         }
     }
 
@@ -185,63 +191,6 @@ static void initializeCharacterInventory() {
     }
 }
 
-// Initializes M_LEVEL array for use with PLACE_MONSTER -RAK-
-static void initializeMonsterLevels() {
-    for (auto &level : monster_levels) {
-        level = 0;
-    }
-
-    for (int i = 0; i < MON_MAX_CREATURES - config::monsters::MON_ENDGAME_MONSTERS; i++) {
-        monster_levels[creatures_list[i].level]++;
-    }
-
-    for (int i = 1; i <= MON_MAX_LEVELS; i++) {
-        monster_levels[i] += monster_levels[i - 1];
-    }
-}
-
-// Initializes T_LEVEL array for use with PLACE_OBJECT -RAK-
-static void initializeTreasureLevels() {
-    for (auto &level : treasure_levels) {
-        level = 0;
-    }
-
-    for (int i = 0; i < MAX_DUNGEON_OBJECTS; i++) {
-        treasure_levels[game_objects[i].depth_first_found]++;
-    }
-
-    for (int i = 1; i <= TREASURE_MAX_LEVELS; i++) {
-        treasure_levels[i] += treasure_levels[i - 1];
-    }
-
-    // now produce an array with object indexes sorted by level,
-    // by using the info in treasure_levels, this is an O(n) sort!
-    // this is not a stable sort, but that does not matter
-    int indexes[TREASURE_MAX_LEVELS + 1] = {};
-    for (auto &i : indexes) {
-        i = 1;
-    }
-
-    for (int i = 0; i < MAX_DUNGEON_OBJECTS; i++) {
-        int level = game_objects[i].depth_first_found;
-        int object_id = treasure_levels[level] - indexes[level];
-
-        sorted_objects[object_id] = (int16_t) i;
-
-        indexes[level]++;
-    }
-}
-
-// Adjust prices of objects -RAK-
-static void priceAdjust() {
-#if (COST_ADJUSTMENT != 100)
-    // round half-way cases up
-    for (auto &item : game_objects) {
-        item.cost = ((item.cost * COST_ADJUSTMENT) + 50) / 100;
-    }
-#endif
-}
-
 // Moria game module -RAK-
 // The code in this section has gone through many revisions, and
 // some of it could stand some more hard work. -RAK-
@@ -256,6 +205,7 @@ static void resetDungeonFlags() {
     game.teleport_player = false;
     monster_multiply_total = 0;
     dg.floor[py.pos.y][py.pos.x].creature_id = 1;
+    playerTravelResetLevel();
 }
 
 // Check light status for dungeon setup
@@ -1034,7 +984,10 @@ static void executeInputCommands(char &command, int &find_count) {
                 playerEndRunning();
             }
 
-            putQIO();
+            // corridor runs are shown where they stop
+            if (!playerRunningInCorridor()) {
+                putQIO();
+            }
             continue;
         }
 
@@ -1162,6 +1115,8 @@ static char originalCommands(char command) {
         case '/':
         case '<':
         case '>':
+        case '_':
+        case 'O':
         case '-':
         case '=':
         case '{':
@@ -1321,6 +1276,8 @@ static char originalCommands(char command) {
         case CTRL_KEY('U'): // ^U = summon
             command = '&';
             break;
+        case CTRL_KEY('Q'): // ^Q = profiling
+            break;
         default:
             command = '~'; // Anything illegal.
             break;
@@ -1620,6 +1577,10 @@ static void doWizardCommands(char command) {
             // NOTE: every field from the struct needs to be filled correctly
             wizardCreateObjects();
             break;
+        case CTRL_KEY('Q'):
+            // Show hot path profiling statistics
+            profileDisplay();
+            break;
         default:
             if (config::options::use_roguelike_keys) {
                 putStringClearToEOL("Type '?' or '\\' for help.", Coord_t{0, 0});
@@ -1781,6 +1742,12 @@ static void doCommand(char command) {
             commandLocateOnMap();
             game.player_free_turn = true;
             break;
+        case '_': // (_) travel to a known place
+            playerTravel();
+            break;
+        case 'O': // (O) explore the level
+            playerExplore();
+            break;
         case 'R': // (R)est a while
             playerRestOn();
             break;
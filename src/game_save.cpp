@@ -17,6 +17,8 @@ DEBUG(static FILE *logfile)
 
 static bool saveChar(const std::string &filename);
 static bool svWrite();
+static void wrLevel();
+static bool rdLevel();
 
 static void wrBool(bool value);
 static void wrByte(uint8_t value);
@@ -29,7 +31,9 @@ static void wrShorts(uint16_t *value, int count);
 static void wrItem(Inventory_t &item);
 static void wrMonster(Monster_t const &monster);
 
+static void putByte(uint8_t value);
 static uint8_t getByte();
+static bool readFailed();
 
 static bool rdBool();
 static uint8_t rdByte();
@@ -48,6 +52,11 @@ static uint8_t xor_byte;
 static int from_save_file;   // can overwrite old save file when save
 static uint32_t start_time; // time that play started
 
+// Level snapshots use the same format as save files, but are kept in memory
+static std::vector<uint8_t> *memory_out = nullptr;
+static std::vector<uint8_t> const *memory_in = nullptr;
+static size_t memory_in_pos = 0;
+
 // This save package was brought to by                -JWT-
 // and                                                -RAK-
 // and has been completely rewritten for UNIX by      -JEW-
@@ -59,6 +68,13 @@ bool saveGame() {
     vtype_t input = {'\0'};
     std::string output;
 
+    replayCheckpoint();
+
+    // how many turn overs of stock each store has missed is not saved
+    for (int store_id = 0; store_id < MAX_STORES; store_id++) {
+        storeMaintenanceCatchUp(store_id);
+    }
+
     while (!saveChar(config::files::save_game)) {
         output = "Save file '" + config::files::save_game + "' fails.";
         printMessage(output.c_str());
@@ -79,13 +95,15 @@ bool saveGame() {
             }
         }
         output = "Saving with '" + config::files::save_game + "'...";
-        putStringClearToEOL(output, Coord_t{0, 0});
+        putStringClearToEOL(output.c_str(), Coord_t{0, 0});
     }
 
     return true;
 }
 
 static bool svWrite() {
+    PROFILE_SCOPE(SaveWrite);
+
     // clear the game.character_is_dead flag when creating a HANGUP save file,
     // so that player can see tombstone when restart
     if (eof_flag != 0) {
@@ -130,6 +148,17 @@ static bool svWrite() {
     if (config::options::use_colors) {
         l |= 0x800;
     }
+    if (config::options::persistent_levels) {
+        l |= 0x1000;
+    }
+    // Options added since 5.7 are saved so that a clear bit, as in older
+    // saves, gives their default.
+    if (!config::options::animate_projectiles) {
+        l |= 0x2000;
+    }
+    if (config::options::accept_final_offers) {
+        l |= 0x4000;
+    }
     if (game.character_is_dead) {
         // Sign bit
         l |= 0x80000000L;
@@ -317,6 +346,22 @@ static bool svWrite() {
         return !((ferror(fileptr) != 0) || fflush(fileptr) == EOF);
     }
 
+    wrLevel();
+
+    // recently visited levels, see level_cache.cpp
+    auto &snapshots = levelCacheSnapshots();
+    wrShort((uint16_t) snapshots.size());
+    for (auto &snapshot : snapshots) {
+        wrShort((uint16_t) snapshot.depth);
+        wrLong((uint32_t) snapshot.data.size());
+        wrBytes(snapshot.data.data(), (int) snapshot.data.size());
+    }
+
+    return !((ferror(fileptr) != 0) || fflush(fileptr) == EOF);
+}
+
+// Writes the current level: the map, the objects on it and its monsters.
+static void wrLevel() {
     wrShort((uint16_t) dg.current_level);
     wrShort((uint16_t) py.pos.y);
     wrShort((uint16_t) py.pos.x);
@@ -379,12 +424,92 @@ static bool svWrite() {
     for (int i = config::treasure::MIN_TREASURE_LIST_ID; i < game.treasure.current_id; i++) {
         wrItem(game.treasure.list[i]);
     }
+    monsterScheduleSyncDistances();
+
     wrShort((uint16_t) next_free_monster_id);
     for (int i = config::monsters::MON_MIN_INDEX_ID; i < next_free_monster_id; i++) {
         wrMonster(monsters[i]);
     }
+}
 
-    return !((ferror(fileptr) != 0) || fflush(fileptr) == EOF);
+// Reads back a level written by wrLevel(), returning false if it is not valid.
+static bool rdLevel() {
+    dg.current_level = rdShort();
+    py.pos.y = rdShort();
+    py.pos.x = rdShort();
+    monster_multiply_total = rdShort();
+    dg.height = rdShort();
+    dg.width = rdShort();
+    dg.panel.max_rows = rdShort();
+    dg.panel.max_cols = rdShort();
+
+    uint8_t char_tmp, ychar, xchar, count;
+
+    // read in the creature ptr info
+    char_tmp = rdByte();
+    while (char_tmp != 0xFF) {
+        ychar = char_tmp;
+        xchar = rdByte();
+        char_tmp = rdByte();
+        if (xchar > MAX_WIDTH || ychar > MAX_HEIGHT) {
+            return false;
+        }
+        dg.floor[ychar][xchar].creature_id = char_tmp;
+        char_tmp = rdByte();
+    }
+
+    // read in the treasure ptr info
+    char_tmp = rdByte();
+    while (char_tmp != 0xFF) {
+        ychar = char_tmp;
+        xchar = rdByte();
+        char_tmp = rdByte();
+        if (xchar > MAX_WIDTH || ychar > MAX_HEIGHT) {
+            return false;
+        }
+        treasurePlaceOnTile(Coord_t{ychar, xchar}, char_tmp);
+        char_tmp = rdByte();
+    }
+
+    // read in the rest of the cave info
+    Tile_t *tile = &dg.floor[0][0];
+    int total_count = 0;
+    while (total_count != MAX_HEIGHT * MAX_WIDTH) {
+        count = rdByte();
+        char_tmp = rdByte();
+        if (readFailed()) {
+            return false;
+        }
+        for (int i = count; i > 0; i--) {
+            if (tile > &dg.floor[MAX_HEIGHT-1][MAX_WIDTH-1]) {
+                return false;
+            }
+            tile->feature_id = (uint8_t)(char_tmp & 0xF);
+            tile->perma_lit_room = (bool) ((char_tmp >> 4) & 0x1);
+            tile->field_mark = (bool) ((char_tmp >> 5) & 0x1);
+            tile->permanent_light = (bool) ((char_tmp >> 6) & 0x1);
+            tile->temporary_light = (bool) ((char_tmp >> 7) & 0x1);
+            tile++;
+        }
+        total_count += count;
+    }
+
+    game.treasure.current_id = rdShort();
+    if (game.treasure.current_id > LEVEL_MAX_OBJECTS) {
+        return false;
+    }
+    for (int i = config::treasure::MIN_TREASURE_LIST_ID; i < game.treasure.current_id; i++) {
+        rdItem(game.treasure.list[i]);
+    }
+    next_free_monster_id = rdShort();
+    if (next_free_monster_id > MON_TOTAL_ALLOCATIONS) {
+        return false;
+    }
+    for (int i = config::monsters::MON_MIN_INDEX_ID; i < next_free_monster_id; i++) {
+        rdMonster(monsters[i]);
+    }
+
+    return !readFailed();
 }
 
 static bool saveChar(const std::string &filename) {
@@ -461,7 +586,6 @@ static bool saveChar(const std::string &filename) {
 
 // Certain checks are omitted for the wizard. -CJS-
 bool loadGame(bool &generate) {
-    Tile_t *tile = nullptr;
     int c;
     uint32_t time_saved = 0;
     uint8_t version_maj = 0;
@@ -470,7 +594,6 @@ bool loadGame(bool &generate) {
 
     generate = true;
     int fd = -1;
-    int total_count = 0;
 
     // Not required for Mac, because the file name is obtained through a dialog.
     // There is no way for a nonexistent file to be specified. -BS-
@@ -560,6 +683,9 @@ bool loadGame(bool &generate) {
         config::options::error_beep_sound = (l & 0x200) != 0;
         config::options::display_counts = (l & 0x400) != 0;
         config::options::use_colors = (l & 0x800) != 0;
+        config::options::persistent_levels = (l & 0x1000) != 0;
+        config::options::animate_projectiles = (l & 0x2000) == 0;
+        config::options::accept_final_offers = (l & 0x4000) != 0;
 
         // Don't allow resurrection of game.total_winner characters.  It causes
         // problems because the character level is out of the allowed range.
@@ -681,6 +807,7 @@ bool loadGame(bool &generate) {
             py.flags.spells_forgotten = rdLong();
             rdBytes(py.flags.spells_learned_order, 32);
             rdBytes(objects_identified, OBJECT_IDENT_SIZE);
+            itemDescriptionCacheClear();
             game.magic_seed = rdLong();
             game.town_seed = rdLong();
             last_message_id = rdShort();
@@ -705,12 +832,17 @@ bool loadGame(bool &generate) {
                 store.unique_items_counter = rdByte();
                 store.good_purchases = rdShort();
                 store.bad_purchases = rdShort();
+                store.maintenance_due = 0;
                 if (store.unique_items_counter > STORE_MAX_DISCRETE_ITEMS) {
                     goto error;
                 }
                 for (int j = 0; j < store.unique_items_counter; j++) {
                     store.inventory[j].cost = rdLong();
                     rdItem(store.inventory[j].item);
+
+                    // the lowest asking price is not saved, so work it out again
+                    int32_t max_cost;
+                    (void) storeItemSellPrice(store, store.inventory[j].min_cost, max_cost, store.inventory[j].item);
                 }
             }
 
@@ -767,76 +899,29 @@ bool loadGame(bool &generate) {
         // only level specific info should follow,
         // not present for dead characters
 
-        dg.current_level = rdShort();
-        py.pos.y = rdShort();
-        py.pos.x = rdShort();
-        monster_multiply_total = rdShort();
-        dg.height = rdShort();
-        dg.width = rdShort();
-        dg.panel.max_rows = rdShort();
-        dg.panel.max_cols = rdShort();
-
-        uint8_t char_tmp, ychar, xchar, count;
-
-        // read in the creature ptr info
-        char_tmp = rdByte();
-        while (char_tmp != 0xFF) {
-            ychar = char_tmp;
-            xchar = rdByte();
-            char_tmp = rdByte();
-            if (xchar > MAX_WIDTH || ychar > MAX_HEIGHT) {
-                goto error;
-            }
-            dg.floor[ychar][xchar].creature_id = char_tmp;
-            char_tmp = rdByte();
+        if (!rdLevel()) {
+            goto error;
         }
 
-        // read in the treasure ptr info
-        char_tmp = rdByte();
-        while (char_tmp != 0xFF) {
-            ychar = char_tmp;
-            xchar = rdByte();
-            char_tmp = rdByte();
-            if (xchar > MAX_WIDTH || ychar > MAX_HEIGHT) {
+        // recently visited levels, not in older save files
+        c = getc(fileptr);
+        if (c != EOF) {
+            if (ungetc(c, fileptr) == EOF) {
                 goto error;
             }
-            dg.floor[ychar][xchar].treasure_id = char_tmp;
-            char_tmp = rdByte();
-        }
 
-        // read in the rest of the cave info
-        tile = &dg.floor[0][0];
-        total_count = 0;
-        while (total_count != MAX_HEIGHT * MAX_WIDTH) {
-            count = rdByte();
-            char_tmp = rdByte();
-            for (int i = count; i > 0; i--) {
-                if (tile > &dg.floor[MAX_HEIGHT-1][MAX_WIDTH-1]) {
+            int snapshots = rdShort();
+            for (int i = 0; i < snapshots; i++) {
+                auto depth = (int16_t) rdShort();
+                uint32_t size = rdLong();
+                if (size > config::dungeon::LEVEL_CACHE_MAX_BYTES) {
                     goto error;
                 }
-                tile->feature_id = (uint8_t)(char_tmp & 0xF);
-                tile->perma_lit_room = (bool) ((char_tmp >> 4) & 0x1);
-                tile->field_mark = (bool) ((char_tmp >> 5) & 0x1);
-                tile->permanent_light = (bool) ((char_tmp >> 6) & 0x1);
-                tile->temporary_light = (bool) ((char_tmp >> 7) & 0x1);
-                tile++;
-            }
-            total_count += count;
-        }
 
-        game.treasure.current_id = rdShort();
-        if (game.treasure.current_id > LEVEL_MAX_OBJECTS) {
-            goto error;
-        }
-        for (int i = config::treasure::MIN_TREASURE_LIST_ID; i < game.treasure.current_id; i++) {
-            rdItem(game.treasure.list[i]);
-        }
-        next_free_monster_id = rdShort();
-        if (next_free_monster_id > MON_TOTAL_ALLOCATIONS) {
-            goto error;
-        }
-        for (int i = config::monsters::MON_MIN_INDEX_ID; i < next_free_monster_id; i++) {
-            rdMonster(monsters[i]);
+                std::vector<uint8_t> data(size);
+                rdBytes(data.data(), (int) size);
+                levelCacheInsert(depth, std::move(data));
+            }
         }
 
         generate = false; // We have restored a cave - no need to generate.
@@ -943,31 +1028,31 @@ static void wrBool(bool value) {
 
 static void wrByte(uint8_t value) {
     xor_byte ^= value;
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, "BYTE:  %02X = %d\n", (int) xor_byte, (int) value))
 }
 
 static void wrShort(uint16_t value) {
     xor_byte ^= (value & 0xFF);
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, "SHORT: %02X", (int) xor_byte))
     xor_byte ^= ((value >> 8) & 0xFF);
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, " %02X = %d\n", (int) xor_byte, (int) value))
 }
 
 static void wrLong(uint32_t value) {
     xor_byte ^= (value & 0xFF);
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, "LONG:  %02X", (int) xor_byte))
     xor_byte ^= ((value >> 8) & 0xFF);
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, " %02X", (int) xor_byte))
     xor_byte ^= ((value >> 16) & 0xFF);
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, " %02X", (int) xor_byte))
     xor_byte ^= ((value >> 24) & 0xFF);
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, " %02X = %ld\n", (int) xor_byte, (int32_t) value))
 }
 
@@ -978,7 +1063,7 @@ static void wrBytes(uint8_t *value, int count) {
     ptr = value;
     for (int i = 0; i < count; i++) {
         xor_byte ^= *ptr++;
-        (void) putc((int) xor_byte, fileptr);
+        putByte(xor_byte);
         DEBUG(fprintf(logfile, "  %02X = %d", (int) xor_byte, (int) (ptr[-1])))
     }
     DEBUG(fprintf(logfile, "\n"))
@@ -989,11 +1074,11 @@ static void wrString(char *str) {
     DEBUG(fprintf(logfile, "STRING:"))
     while (*str != '\0') {
         xor_byte ^= *str++;
-        (void) putc((int) xor_byte, fileptr);
+        putByte(xor_byte);
         DEBUG(fprintf(logfile, " %02X", (int) xor_byte))
     }
     xor_byte ^= *str;
-    (void) putc((int) xor_byte, fileptr);
+    putByte(xor_byte);
     DEBUG(fprintf(logfile, " %02X = \"%s\"\n", (int) xor_byte, s))
 }
 
@@ -1004,10 +1089,10 @@ static void wrShorts(uint16_t *value, int count) {
 
     for (int i = 0; i < count; i++) {
         xor_byte ^= (*sptr & 0xFF);
-        (void) putc((int) xor_byte, fileptr);
+        putByte(xor_byte);
         DEBUG(fprintf(logfile, "  %02X", (int) xor_byte))
         xor_byte ^= ((*sptr++ >> 8) & 0xFF);
-        (void) putc((int) xor_byte, fileptr);
+        putByte(xor_byte);
         DEBUG(fprintf(logfile, " %02X = %d", (int) xor_byte, (int) sptr[-1]))
     }
     DEBUG(fprintf(logfile, "\n"))
@@ -1042,8 +1127,8 @@ static void wrMonster(Monster_t const &monster) {
     wrShort((uint16_t) monster.sleep_count);
     wrShort((uint16_t) monster.speed);
     wrShort(monster.creature_id);
-    wrByte((uint8_t) monster.pos.y);
-    wrByte((uint8_t) monster.pos.x);
+    wrByte(monster.pos.y);
+    wrByte(monster.pos.x);
     wrByte(monster.distance_from_player);
     wrBool(monster.lit);
     wrByte(monster.stunned_amount);
@@ -1051,10 +1136,61 @@ static void wrMonster(Monster_t const &monster) {
 }
 
 // get_byte reads a single byte from a file, without any xor_byte encryption
+static void putByte(uint8_t value) {
+    if (memory_out != nullptr) {
+        memory_out->push_back(value);
+    } else {
+        (void) putc((int) value, fileptr);
+    }
+}
+
 static uint8_t getByte() {
+    if (memory_in != nullptr) {
+        if (memory_in_pos >= memory_in->size()) {
+            memory_in_pos++;
+            return 0;
+        }
+        return (*memory_in)[memory_in_pos++];
+    }
+
     return (uint8_t)(getc(fileptr) & 0xFF);
 }
 
+// True once reading has gone past the end of the data, or failed.
+static bool readFailed() {
+    if (memory_in != nullptr) {
+        return memory_in_pos > memory_in->size();
+    }
+
+    return feof(fileptr) != 0 || ferror(fileptr) != 0;
+}
+
+// Writes the current level into `data`, in the save file format.
+void levelSnapshotWrite(std::vector<uint8_t> &data) {
+    data.clear();
+
+    memory_out = &data;
+    xor_byte = 0;
+
+    wrLevel();
+
+    memory_out = nullptr;
+}
+
+// Replaces the current level with one from levelSnapshotWrite(),
+// returning false if the data is not valid.
+bool levelSnapshotRead(std::vector<uint8_t> const &data) {
+    memory_in = &data;
+    memory_in_pos = 0;
+    xor_byte = 0;
+
+    bool ok = rdLevel();
+
+    memory_in = nullptr;
+
+    return ok;
+}
+
 static bool rdBool() {
     return (bool) rdByte();
 }
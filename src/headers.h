@@ -33,14 +33,17 @@
 
 #include <cctype>
 #include <cerrno>
+#include <cstdarg>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -63,6 +66,7 @@
 #include "mage_spells.h"
 #include "monster.h"
 #include "player.h"
+#include "profile.h"
 #include "recall.h"
 #include "rng.h"
 #include "scores.h"
@@ -331,6 +331,8 @@ void magicInitializeItemNames() {
     }
 
     seedResetToOldSeed();
+
+    itemDescriptionCacheClear();
 }
 
 int16_t objectPositionOffset(int category_id, int sub_category_id) {
@@ -361,10 +363,12 @@ int16_t objectPositionOffset(int category_id, int sub_category_id) {
 
 static void clearObjectTriedFlag(int16_t id) {
     objects_identified[id] &= ~config::identification::OD_TRIED;
+    itemDescriptionCacheClear();
 }
 
 static void setObjectTriedFlag(int16_t id) {
     objects_identified[id] |= config::identification::OD_TRIED;
+    itemDescriptionCacheClear();
 }
 
 static bool isObjectKnown(int16_t id) {
@@ -547,7 +551,7 @@ enum class ItemMiscUse {
 // The `add_prefix` param indicates that an article must be added.
 // Note that since out_val can easily exceed 80 characters, itemDescription
 // must always be called with a obj_desc_t as the first parameter.
-void itemDescription(obj_desc_t description, Inventory_t const &item, bool add_prefix) {
+static void itemDescriptionFormat(obj_desc_t description, Inventory_t const &item, bool add_prefix) {
     int indexx = item.sub_category_id & (ITEM_SINGLE_STACK_MIN - 1);
 
     // base name, modifier string
@@ -888,6 +892,64 @@ void itemDescription(obj_desc_t description, Inventory_t const &item, bool add_p
     (void) strcat(description, ".");
 }
 
+// itemDescription() is called for every line of every inventory, equipment
+// and store listing each time one is drawn, so recent descriptions are kept.
+//
+// Entries are found by the whole item, so any change to an item, such as
+// its count, identification or inscription, simply finds no entry. What the
+// player knows of each kind of object, in objects_identified[], and the
+// flavor names are not part of the item, so changing them forgets every
+// entry, see itemDescriptionCacheClear().
+constexpr int DESCRIPTION_CACHE_SIZE = 128;
+
+typedef struct {
+    Inventory_t item;
+    bool add_prefix;
+    uint32_t generation;
+    obj_desc_t description;
+} DescriptionCacheEntry_t;
+
+static DescriptionCacheEntry_t description_cache[DESCRIPTION_CACHE_SIZE];
+
+// Entries from an older generation are forgotten. They all start at 0.
+static uint32_t description_generation = 1;
+
+void itemDescriptionCacheClear() {
+    description_generation++;
+}
+
+void itemDescription(obj_desc_t description, Inventory_t const &item, bool add_prefix) {
+    PROFILE_SCOPE(ItemDescription);
+
+    // The bytes after the end of the inscription are not part of the item
+    Inventory_t key = item;
+    bool inscription_ended = false;
+    for (auto &c : key.inscription) {
+        inscription_ended = inscription_ended || c == '\0';
+        if (inscription_ended) {
+            c = '\0';
+        }
+    }
+
+    uint32_t hash = add_prefix ? 2166136261u : 84696351u;
+    auto bytes = reinterpret_cast<const uint8_t *>(&key);
+    for (size_t i = 0; i < sizeof(key); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    DescriptionCacheEntry_t &entry = description_cache[hash % DESCRIPTION_CACHE_SIZE];
+
+    if (entry.generation != description_generation || entry.add_prefix != add_prefix || memcmp(&entry.item, &key, sizeof(key)) != 0) {
+        itemDescriptionFormat(entry.description, key, add_prefix);
+
+        entry.item = key;
+        entry.add_prefix = add_prefix;
+        entry.generation = description_generation;
+    }
+
+    (void) strcpy(description, entry.description);
+}
+
 // Describe number of remaining charges. -RAK-
 void itemChargesRemainingDescription(int item_id) {
     if (!spellItemIdentified(py.inventory[item_id])) {
@@ -110,6 +110,7 @@ void itemSetAsTried(Inventory_t const &item);
 void itemIdentify(Inventory_t &item, int &item_id);
 void itemRemoveMagicNaming(Inventory_t &item);
 void itemDescription(obj_desc_t description, Inventory_t const &item, bool add_prefix);
+void itemDescriptionCacheClear();
 void itemChargesRemainingDescription(int item_id);
 void itemTypeRemainingCountDescription(int item_id);
 void itemInscribe();
@@ -59,7 +59,7 @@ void inventoryDropItem(int item_id, bool drop_all) {
     Inventory_t &item = py.inventory[item_id];
     game.treasure.list[treasure_id] = item;
 
-    dg.floor[py.pos.y][py.pos.x].treasure_id = (uint8_t) treasure_id;
+    treasurePlaceOnTile(py.pos, treasure_id);
 
     if (item_id >= PlayerEquipment::Wield) {
         playerTakeOff(item_id, -1);
@@ -208,12 +208,10 @@ bool executeDisenchantAttack() {
     return success;
 }
 
+// Whether an item would go onto a stack already in the pack, rather
+// than needing a slot of its own.
 // this code must be identical to the inventoryCarryItem() code below
-bool inventoryCanCarryItemCount(Inventory_t const &item) {
-    if (py.pack.unique_items < PlayerEquipment::Wield) {
-        return true;
-    }
-
+bool inventoryItemStacksInPack(Inventory_t const &item) {
     if (!inventoryItemStackable(item) ) {
         return false;
     }
@@ -243,6 +241,14 @@ bool inventoryCanCarryItemCount(Inventory_t const &item) {
     return false;
 }
 
+bool inventoryCanCarryItemCount(Inventory_t const &item) {
+    if (py.pack.unique_items < PlayerEquipment::Wield) {
+        return true;
+    }
+
+    return inventoryItemStacksInPack(item);
+}
+
 // return false if picking up an object would change the players speed
 bool inventoryCanCarryItem(Inventory_t const &item) {
     int limit = playerCarryingLoadLimit();
@@ -334,27 +340,7 @@ bool inventoryFindRange(int item_id_start, int item_id_end, int &j, int &k) {
 }
 
 void inventoryItemCopyTo(int from_item_id, Inventory_t &to_item) {
-    DungeonObject_t const &from = game_objects[from_item_id];
-
-    to_item.id = (uint16_t) from_item_id;
-    to_item.special_name_id = SpecialNameIds::SN_NULL;
-    to_item.inscription[0] = '\0';
-    to_item.flags = from.flags;
-    to_item.category_id = from.category_id;
-    to_item.sprite = from.sprite;
-    to_item.misc_use = from.misc_use;
-    to_item.cost = from.cost;
-    to_item.sub_category_id = from.sub_category_id;
-    to_item.items_count = from.items_count;
-    to_item.weight = from.weight;
-    to_item.to_hit = from.to_hit;
-    to_item.to_damage = from.to_damage;
-    to_item.ac = from.ac;
-    to_item.to_ac = from.to_ac;
-    to_item.damage.dice = from.damage.dice;
-    to_item.damage.sides = from.damage.sides;
-    to_item.depth_first_found = from.depth_first_found;
-    to_item.identification = 0;
+    to_item = game_object_items[from_item_id];
 }
 
 // Checks if an item is stackable, only as a singles object.
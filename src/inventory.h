@@ -29,10 +29,10 @@ constexpr uint8_t INSCRIP_SIZE = 13;
 // Inventory_t is created for an item the player may wear about
 // their person, or store in their inventory pack.
 //
-// Only damage, ac, and tchar are constant; level could possibly be made
-// constant by changing index instead; all are used rarely.
-//
-// Extra fields x and y for location in dungeon would simplify pusht().
+// Nearly every field can change after an item is made: doors change their
+// tchar when found, chests their level, and the wizard can forge anything.
+// New items are copied whole from game_object_items[], which is made from
+// game_objects[] at compile time.
 //
 // Making inscrip[] a pointer and malloc-ing space does not work, there are
 // two many places where `Inventory_t` are copied, which results in dangling
@@ -58,6 +58,8 @@ typedef struct {
     uint8_t identification;         // Identify information
 } Inventory_t;
 
+static_assert(sizeof(Inventory_t) == 44, "Inventory_t has no padding, keep it that way when adding fields");
+
 // magic numbers for players equipment inventory array
 enum PlayerEquipment {
     Wield = 22, // must be first item in equipment list
@@ -82,6 +84,7 @@ void inventoryDropItem(int item_id, bool drop_all);
 bool inventoryDiminishLightAttack(bool noticed);
 bool inventoryDiminishChargesAttack(uint8_t creature_level, int16_t &monster_hp, bool noticed);
 bool executeDisenchantAttack();
+bool inventoryItemStacksInPack(Inventory_t const &item);
 bool inventoryCanCarryItemCount(Inventory_t const &item);
 bool inventoryCanCarryItem(Inventory_t const &item);
 int inventoryCarryItem(Inventory_t &new_item);
@@ -0,0 +1,111 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Keep recently visited dungeon levels, when persistent levels are enabled
+
+#include "headers.h"
+
+// Levels are kept in the same run length encoded format the save file uses,
+// least recently visited first. When the snapshots take up more than
+// LEVEL_CACHE_MAX_BYTES, the oldest are forgotten.
+static std::vector<LevelSnapshot_t> level_cache;
+
+static size_t levelCacheBytes() {
+    size_t bytes = 0;
+
+    for (auto const &snapshot : level_cache) {
+        bytes += snapshot.data.size();
+    }
+
+    return bytes;
+}
+
+static void levelCacheForget(int depth) {
+    for (auto it = level_cache.begin(); it != level_cache.end(); ++it) {
+        if (it->depth == depth) {
+            level_cache.erase(it);
+            return;
+        }
+    }
+}
+
+// Adds a level as the most recently visited one.
+void levelCacheInsert(int depth, std::vector<uint8_t> data) {
+    levelCacheForget(depth);
+
+    level_cache.push_back(LevelSnapshot_t{(int16_t) depth, std::move(data)});
+
+    while (levelCacheBytes() > config::dungeon::LEVEL_CACHE_MAX_BYTES) {
+        level_cache.erase(level_cache.begin());
+    }
+}
+
+// Called when the player leaves a level, which was made for the given depth.
+// The town is always the same, so it is never kept.
+void levelCacheStore(int depth) {
+    if (!config::options::persistent_levels) {
+        level_cache.clear();
+        return;
+    }
+
+    if (depth == 0) {
+        return;
+    }
+
+    // The player and their light leave with them
+    dg.floor[py.pos.y][py.pos.x].creature_id = 0;
+    for (int y = 0; y < dg.height; y++) {
+        for (int x = 0; x < dg.width; x++) {
+            dg.floor[y][x].temporary_light = false;
+        }
+    }
+
+    std::vector<uint8_t> data;
+    levelSnapshotWrite(data);
+
+    levelCacheInsert(depth, std::move(data));
+}
+
+// Replaces generateCave() when the current depth was visited recently,
+// putting the player somewhere on the level as they left it.
+bool levelCacheRestore(int depth) {
+    if (!config::options::persistent_levels || depth == 0) {
+        return false;
+    }
+
+    for (auto it = level_cache.begin(); it != level_cache.end(); ++it) {
+        if (it->depth != depth) {
+            continue;
+        }
+
+        dungeonClearLevel();
+
+        bool restored = levelSnapshotRead(it->data);
+
+        // Kept levels are only used once, the player is now on it
+        level_cache.erase(it);
+
+        if (!restored) {
+            return false;
+        }
+
+        dg.current_level = (int16_t) depth;
+        dg.panel.row = dg.panel.max_rows;
+        dg.panel.col = dg.panel.max_cols;
+
+        Coord_t coord = Coord_t{0, 0};
+        dungeonNewSpot(coord);
+        py.pos.y = coord.y;
+        py.pos.x = coord.x;
+
+        return true;
+    }
+
+    return false;
+}
+
+std::vector<LevelSnapshot_t> &levelCacheSnapshots() {
+    return level_cache;
+}
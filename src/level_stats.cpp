@@ -0,0 +1,247 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// umoria-level-stats: sample the monster and object tables, for tuning them
+
+#include "headers.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static const char *usage_instructions = R"(
+Usage:
+    umoria-level-stats [OPTIONS]
+
+Picks monsters and objects for each dungeon depth, the same way a new level
+does, and writes out how often each one turned up.
+
+Options:
+    -n NUMBER    Monsters and objects to pick per depth (default: 1000000)
+    -d FIRST     First depth (default: 1)
+    -D LAST      Last depth (default: 50)
+    -c           Only pick objects small enough to fit in a chest
+    -s NUMBER    Seed, each depth uses the seed plus its depth (default: 1)
+    -j NUMBER    Threads to use (default: one per CPU)
+    --json       Write JSON instead of CSV
+    -h           Display this message
+)";
+
+typedef struct {
+    uint64_t count;
+    uint64_t cursed;
+    uint64_t special;
+    uint64_t total_cost;
+} ObjectStats_t;
+
+typedef struct {
+    int depth;
+    ObjectStats_t objects[MAX_DUNGEON_OBJECTS];
+    uint64_t monsters[MON_MAX_CREATURES];
+} DepthStats_t;
+
+static void sampleDepth(DepthStats_t &stats, int samples, bool must_be_small, uint32_t seed, int treasure_id) {
+    setRandomSeed(seed + (uint32_t) stats.depth);
+
+    Inventory_t &item = game.treasure.list[treasure_id];
+
+    for (int i = 0; i < samples; i++) {
+        int object_id = sorted_objects[itemGetRandomObjectId(stats.depth, must_be_small)];
+
+        // as dungeonPlaceRandomObjectAt() does
+        inventoryItemCopyTo(object_id, item);
+        magicTreasureMagicalAbility(treasure_id, stats.depth);
+
+        ObjectStats_t &object = stats.objects[object_id];
+        object.count++;
+        object.total_cost += (uint64_t) std::max(item.cost, 0);
+        if ((item.flags & config::treasure::flags::TR_CURSED) != 0u) {
+            object.cursed++;
+        }
+        if (item.special_name_id != SpecialNameIds::SN_NULL) {
+            object.special++;
+        }
+
+        stats.monsters[monsterGetOneSuitableForLevel(stats.depth)]++;
+    }
+}
+
+// Names may contain quotes, so escape them for both CSV and JSON.
+static std::string quoted(const char *name, char escape) {
+    std::string text = "\"";
+
+    for (const char *c = name; *c != '\0'; c++) {
+        if (*c == '"') {
+            text += escape;
+        }
+        text += *c;
+    }
+
+    return text + "\"";
+}
+
+static void printCSV(std::vector<DepthStats_t> const &depths) {
+    printf("kind,depth,id,name,count,cursed,special,mean_cost\n");
+
+    for (auto const &stats : depths) {
+        for (int id = 0; id < MAX_DUNGEON_OBJECTS; id++) {
+            ObjectStats_t const &object = stats.objects[id];
+            if (object.count == 0) {
+                continue;
+            }
+
+            printf("object,%d,%d,%s,%lu,%lu,%lu,%.2f\n",
+                   stats.depth,
+                   id,
+                   quoted(game_objects[id].name, '"').c_str(),
+                   (unsigned long) object.count,
+                   (unsigned long) object.cursed,
+                   (unsigned long) object.special,
+                   (double) object.total_cost / (double) object.count);
+        }
+
+        for (int id = 0; id < MON_MAX_CREATURES; id++) {
+            if (stats.monsters[id] == 0) {
+                continue;
+            }
+
+            printf("monster,%d,%d,%s,%lu,,,\n", stats.depth, id, quoted(creatures_list[id].name, '"').c_str(), (unsigned long) stats.monsters[id]);
+        }
+    }
+}
+
+static void printJSON(std::vector<DepthStats_t> const &depths, int samples) {
+    printf("{\n  \"samples\": %d,\n  \"depths\": [", samples);
+
+    for (size_t i = 0; i < depths.size(); i++) {
+        DepthStats_t const &stats = depths[i];
+
+        printf("%s\n    {\n      \"depth\": %d,\n      \"objects\": [", i == 0 ? "" : ",", stats.depth);
+
+        const char *separator = "";
+        for (int id = 0; id < MAX_DUNGEON_OBJECTS; id++) {
+            ObjectStats_t const &object = stats.objects[id];
+            if (object.count == 0) {
+                continue;
+            }
+
+            printf("%s\n        {\"id\": %d, \"name\": %s, \"count\": %lu, \"cursed\": %lu, \"special\": %lu, \"mean_cost\": %.2f}",
+                   separator,
+                   id,
+                   quoted(game_objects[id].name, '\\').c_str(),
+                   (unsigned long) object.count,
+                   (unsigned long) object.cursed,
+                   (unsigned long) object.special,
+                   (double) object.total_cost / (double) object.count);
+            separator = ",";
+        }
+
+        printf("\n      ],\n      \"monsters\": [");
+
+        separator = "";
+        for (int id = 0; id < MON_MAX_CREATURES; id++) {
+            if (stats.monsters[id] == 0) {
+                continue;
+            }
+
+            printf("%s\n        {\"id\": %d, \"name\": %s, \"count\": %lu}", separator, id, quoted(creatures_list[id].name, '\\').c_str(), (unsigned long) stats.monsters[id]);
+            separator = ",";
+        }
+
+        printf("\n      ]\n    }");
+    }
+
+    printf("\n  ]\n}\n");
+}
+
+// Reads the NUMBER following an option, returning false if there is not a valid one.
+static bool parseNumber(int &argc, char **&argv, int &number) {
+    if (argv[1] == nullptr || !stringToNumber(argv[1], number) || number < 0) {
+        return false;
+    }
+
+    --argc;
+    ++argv;
+
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int samples = 1000000;
+    int first_depth = 1;
+    int last_depth = TREASURE_MAX_LEVELS;
+    int seed = 1;
+    int threads = (int) std::thread::hardware_concurrency();
+    bool must_be_small = false;
+    bool json = false;
+
+    for (--argc, ++argv; argc > 0; --argc, ++argv) {
+        bool valid = true;
+
+        if (strcmp(argv[0], "-n") == 0) {
+            valid = parseNumber(argc, argv, samples);
+        } else if (strcmp(argv[0], "-d") == 0) {
+            valid = parseNumber(argc, argv, first_depth);
+        } else if (strcmp(argv[0], "-D") == 0) {
+            valid = parseNumber(argc, argv, last_depth);
+        } else if (strcmp(argv[0], "-s") == 0) {
+            valid = parseNumber(argc, argv, seed);
+        } else if (strcmp(argv[0], "-j") == 0) {
+            valid = parseNumber(argc, argv, threads);
+        } else if (strcmp(argv[0], "-c") == 0) {
+            must_be_small = true;
+        } else if (strcmp(argv[0], "--json") == 0) {
+            json = true;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            fprintf(stderr, "%s", usage_instructions);
+            return 1;
+        }
+    }
+
+    // Depth 0 is the town, where nothing is picked this way
+    if (first_depth < 1 || last_depth < first_depth) {
+        fprintf(stderr, "Depths must be from 1 upwards\n");
+        return 1;
+    }
+
+    levelTablesInitialize();
+
+    std::vector<DepthStats_t> depths((size_t) (last_depth - first_depth + 1));
+    for (size_t i = 0; i < depths.size(); i++) {
+        depths[i] = DepthStats_t{};
+        depths[i].depth = first_depth + (int) i;
+    }
+
+    // Each thread takes the next depth not yet done, and makes its
+    // objects in its own game.treasure.list[] record.
+    threads = std::max(1, std::min(threads, std::min((int) depths.size(), LEVEL_MAX_OBJECTS - 1)));
+
+    std::atomic<size_t> next_depth{0};
+    std::vector<std::thread> workers;
+
+    for (int thread = 0; thread < threads; thread++) {
+        workers.emplace_back([&, thread]() {
+            for (size_t i = next_depth++; i < depths.size(); i = next_depth++) {
+                sampleDepth(depths[i], samples, must_be_small, (uint32_t) seed, thread + 1);
+            }
+        });
+    }
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    if (json) {
+        printJSON(depths, samples);
+    } else {
+        printCSV(depths);
+    }
+
+    return 0;
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Per depth alias tables for picking random monsters and objects
+
+#include "headers.h"
+
+// Picking a monster or object for a dungeon level used to take a handful of
+// random numbers: a roll for a "nasty" monster or "great" item, a best of
+// two or three roll to favour deeper things, a pick within the chosen depth,
+// and for objects which must fit in a chest, starting over until one does.
+//
+// The chances of each monster and object turning up on every depth are
+// worked out here instead, exactly as those rolls would give them, and put
+// into Walker alias tables. A pick is then always one column number plus
+// one biased coin flip.
+
+typedef struct {
+    uint32_t threshold; // keep `value` if rnd() is no more than this
+    int16_t value;
+    int16_t alias;
+} AliasColumn_t;
+
+typedef struct {
+    uint16_t size;
+    AliasColumn_t columns[MAX_DUNGEON_OBJECTS];
+} ObjectAliasTable_t;
+
+typedef struct {
+    uint16_t size;
+    AliasColumn_t columns[MON_MAX_CREATURES];
+} MonsterAliasTable_t;
+
+static ObjectAliasTable_t object_tables[TREASURE_MAX_LEVELS + 1];
+static ObjectAliasTable_t small_object_tables[TREASURE_MAX_LEVELS + 1];
+static MonsterAliasTable_t monster_tables[MON_MAX_LEVELS + 1];
+
+// rnd() returns 1 to 2^31 - 2
+constexpr double ALIAS_COIN_SIDES = 2147483646.0;
+
+// Fills `columns` with an alias table for the given chances, which must add
+// up to 1, leaving out anything which can never be picked. Returns the size.
+static uint16_t aliasTableBuild(AliasColumn_t *columns, double const *chances, int count) {
+    // Work space, large enough for either table
+    static double scaled[MAX_DUNGEON_OBJECTS];
+    static int small[MAX_DUNGEON_OBJECTS];
+    static int large[MAX_DUNGEON_OBJECTS];
+
+    int size = 0;
+    for (int i = 0; i < count; i++) {
+        if (chances[i] > 0) {
+            columns[size].value = (int16_t) i;
+            size++;
+        }
+    }
+
+    int small_count = 0;
+    int large_count = 0;
+
+    for (int i = 0; i < size; i++) {
+        scaled[i] = chances[columns[i].value] * size;
+
+        if (scaled[i] < 1.0) {
+            small[small_count++] = i;
+        } else {
+            large[large_count++] = i;
+        }
+    }
+
+    while (small_count > 0 && large_count > 0) {
+        int less = small[--small_count];
+        int more = large[--large_count];
+
+        columns[less].threshold = (uint32_t) (scaled[less] * ALIAS_COIN_SIDES);
+        columns[less].alias = columns[more].value;
+
+        scaled[more] -= 1.0 - scaled[less];
+
+        if (scaled[more] < 1.0) {
+            small[small_count++] = more;
+        } else {
+            large[large_count++] = more;
+        }
+    }
+
+    // Whatever is left is 1, give or take rounding errors
+    while (large_count > 0) {
+        int i = large[--large_count];
+        columns[i].threshold = UINT32_MAX;
+        columns[i].alias = columns[i].value;
+    }
+    while (small_count > 0) {
+        int i = small[--small_count];
+        columns[i].threshold = UINT32_MAX;
+        columns[i].alias = columns[i].value;
+    }
+
+    return (uint16_t) size;
+}
+
+static int aliasTableDraw(AliasColumn_t const *columns, uint16_t size) {
+    AliasColumn_t const &column = columns[randomNumber(size) - 1];
+
+    if ((uint32_t) rnd() <= column.threshold) {
+        return column.value;
+    }
+
+    return column.alias;
+}
+
+// Chances of each object being picked once the level to pick from is
+// known, added to `chances` scaled by `weight`.
+//
+// Half the time any object up to that level is picked. Otherwise three are
+// picked, and the deepest decides the level to pick an object from.
+// This makes a level n object turn up about 2/n% of the time on level n,
+// and 1/2n are 0th level.
+static void objectChancesForLevel(double *chances, int level, bool must_be_small, double weight) {
+    static double level_chances[MAX_DUNGEON_OBJECTS];
+
+    int count = treasure_levels[level];
+
+    for (int id = 0; id < count; id++) {
+        level_chances[id] = 0.5 / count;
+    }
+
+    double cubed = (double) count * count * count;
+
+    for (int id = 0; id < count; id++) {
+        // (id + 1)^3 - id^3 ways for the best of three to be `id`
+        double best_of_three = (3.0 * id * id + 3.0 * id + 1.0) / cubed;
+
+        int found_level = game_objects[sorted_objects[id]].depth_first_found;
+        int first = found_level == 0 ? 0 : treasure_levels[found_level - 1];
+        int last = treasure_levels[found_level];
+
+        for (int other = first; other < last; other++) {
+            level_chances[other] += 0.5 * best_of_three / (last - first);
+        }
+    }
+
+    // Objects too large for a chest were picked again, until one fitted
+    double total = 0;
+    for (int id = 0; id < count; id++) {
+        if (must_be_small && itemBiggerThanChest(game_objects[sorted_objects[id]])) {
+            level_chances[id] = 0;
+        }
+        total += level_chances[id];
+    }
+
+    for (int id = 0; id < count; id++) {
+        chances[id] += weight * level_chances[id] / total;
+    }
+}
+
+// Chances of each object being picked on a dungeon level, where one time in
+// TREASURE_CHANCE_OF_GREAT_ITEM the level is raised by a random factor.
+static void objectChances(double *chances, int level, bool must_be_small) {
+    for (int id = 0; id < MAX_DUNGEON_OBJECTS; id++) {
+        chances[id] = 0;
+    }
+
+    if (level == TREASURE_MAX_LEVELS) {
+        objectChancesForLevel(chances, level, must_be_small, 1.0);
+        return;
+    }
+
+    double great = 1.0 / config::treasure::TREASURE_CHANCE_OF_GREAT_ITEM;
+
+    objectChancesForLevel(chances, level, must_be_small, 1.0 - great);
+
+    for (int roll = 1; roll <= TREASURE_MAX_LEVELS; roll++) {
+        int great_level = std::min(level * TREASURE_MAX_LEVELS / roll + 1, (int) TREASURE_MAX_LEVELS);
+        objectChancesForLevel(chances, great_level, must_be_small, great / TREASURE_MAX_LEVELS);
+    }
+}
+
+// Chances of each monster being picked on a dungeon level.
+//
+// One time in MON_CHANCE_OF_NASTY the level is raised by a normally
+// distributed amount, otherwise the deeper of two monsters up to that level
+// decides the level. Either way any monster of that level is then picked.
+// This makes a level n monster turn up about 2/n% of the time on level n,
+// and 1/n*n% are 1st level.
+static void monsterChances(double *chances, int level) {
+    static double level_chances[MON_MAX_LEVELS + 1];
+
+    for (auto &chance : level_chances) {
+        chance = 0;
+    }
+
+    double nasty = 1.0 / config::monsters::MON_CHANCE_OF_NASTY;
+
+    // randomNumberNormalDistribution(0, 4), which is only ever used as a
+    // distance here, so the sign can be ignored
+    for (int roll = 1; roll <= SHRT_MAX; roll++) {
+        if (roll == SHRT_MAX) {
+            for (int extra = 1; extra <= 4; extra++) {
+                int nasty_level = std::min(level + 4 * 4 + extra + 1, (int) MON_MAX_LEVELS);
+                level_chances[nasty_level] += nasty / SHRT_MAX / 4;
+            }
+            continue;
+        }
+
+        int offset = ((4 * normalTableIndex(roll)) + (NORMAL_TABLE_SD >> 1)) / NORMAL_TABLE_SD;
+        int nasty_level = std::min(level + offset + 1, (int) MON_MAX_LEVELS);
+        level_chances[nasty_level] += nasty / SHRT_MAX;
+    }
+
+    int count = monster_levels[level] - monster_levels[0];
+    double squared = (double) count * count;
+
+    for (int i = 0; i < count; i++) {
+        // (i + 1)^2 - i^2 ways for the best of two to be `i`
+        double best_of_two = (2.0 * i + 1.0) / squared;
+        level_chances[creatures_list[i + monster_levels[0]].level] += (1.0 - nasty) * best_of_two;
+    }
+
+    for (int id = 0; id < MON_MAX_CREATURES; id++) {
+        chances[id] = 0;
+    }
+
+    for (int i = 1; i <= MON_MAX_LEVELS; i++) {
+        int first = monster_levels[i - 1];
+        int last = monster_levels[i];
+
+        for (int id = first; id < last; id++) {
+            chances[id] = level_chances[i] / (last - first);
+        }
+    }
+}
+
+// Builds the alias tables from monster_levels[], treasure_levels[] and
+// sorted_objects[], which are made at compile time.
+void levelTablesInitialize() {
+    static double chances[MAX_DUNGEON_OBJECTS];
+
+    for (int level = 1; level <= TREASURE_MAX_LEVELS; level++) {
+        objectChances(chances, level, false);
+        object_tables[level].size = aliasTableBuild(object_tables[level].columns, chances, MAX_DUNGEON_OBJECTS);
+
+        objectChances(chances, level, true);
+        small_object_tables[level].size = aliasTableBuild(small_object_tables[level].columns, chances, MAX_DUNGEON_OBJECTS);
+    }
+
+    for (int level = 1; level <= MON_MAX_LEVELS; level++) {
+        monsterChances(chances, level);
+        monster_tables[level].size = aliasTableBuild(monster_tables[level].columns, chances, MON_MAX_CREATURES);
+    }
+}
+
+// Returns an index into sorted_objects[] for a level from 1 to TREASURE_MAX_LEVELS.
+int levelTablesPickObject(int level, bool must_be_small) {
+    ObjectAliasTable_t const &table = must_be_small ? small_object_tables[level] : object_tables[level];
+    return aliasTableDraw(table.columns, table.size);
+}
+
+// Returns a creatures_list[] index for a level from 1 to MON_MAX_LEVELS.
+int levelTablesPickMonster(int level) {
+    MonsterAliasTable_t const &table = monster_tables[level];
+    return aliasTableDraw(table.columns, table.size);
+}
@@ -9,6 +9,7 @@
 #include "version.h"
 
 static bool parseGameSeed(const char *argv, uint32_t &seed);
+static void printUsage();
 
 static const char *usage_instructions = R"(
 Usage:
@@ -20,6 +21,13 @@ Options:
     -n           Force start of new game
     -d           Display high scores and exit
     -s NUMBER    Game Seed, as a decimal number (max: 2147483647)
+    -r FILE      Record the game session to FILE
+    -p FILE      Play back a recorded session and exit
+    -k FILE      Start a new game, logging every key press to FILE
+    --replay FILE
+                 Replay a key log at full speed, without display,
+                 and verify the game ends in the same state
+
 
     -v           Print version info and exit
     -h           Display this message
@@ -29,6 +37,8 @@ Options:
 int main(int argc, char *argv[]) {
     uint32_t seed = 0;
     bool new_game = false;
+    const char *key_log = nullptr;
+    const char *replay_log = nullptr;
 
     // call this routine to grab a file pointer to the high score file
     // and prepare things to relinquish setuid privileges
@@ -80,17 +90,93 @@ int main(int argc, char *argv[]) {
             case 'w':
                 game.to_be_wizard = true;
                 break;
-            default:
-                terminalRestore();
+            case 'r':
+                // No FILE provided?
+                if (argv[1] == nullptr) {
+                    break;
+                }
+
+                --argc;
+                ++argv;
+
+                if (!recordingStart(argv[0])) {
+                    terminalRestore();
+                    printf("Can't open recording file '%s'\n", argv[0]);
+                    return 1;
+                }
+
+                break;
+            case 'p':
+                if (argv[1] == nullptr) {
+                    break;
+                }
+
+                if (!recordingPlayback(argv[1])) {
+                    terminalRestore();
+                    printf("Can't play back recording file '%s'\n", argv[1]);
+                    return 1;
+                }
+
+                exitProgram();
+                break;
+            case 'k':
+                if (argv[1] == nullptr) {
+                    break;
+                }
 
-                printf("Robert A. Koeneke's classic dungeon crawler.\n");
-                printf("Umoria %d.%d.%d is released under a GPL-3.0-or-later license.\n", CURRENT_VERSION_MAJOR,
-                       CURRENT_VERSION_MINOR, CURRENT_VERSION_PATCH);
-                printf("%s", usage_instructions);
+                --argc;
+                ++argv;
+
+                key_log = argv[0];
+                break;
+            case '-':
+                if (strcmp(argv[0], "--replay") == 0 && argv[1] != nullptr) {
+                    --argc;
+                    ++argv;
+
+                    replay_log = argv[0];
+                    break;
+                }
+
+                printUsage();
+                return 0;
+            default:
+                printUsage();
                 return 0;
         }
     }
 
+    // Key logs are always a new game, so everything that happens is in the log.
+    if (key_log != nullptr) {
+        if (seed == 0) {
+            seed = getCurrentUnixTime();
+        }
+
+        if (!replayRecordStart(key_log, seed)) {
+            terminalRestore();
+            printf("Can't open key log file '%s'\n", key_log);
+            return 1;
+        }
+
+        new_game = true;
+    }
+
+    if (replay_log != nullptr) {
+        if (!replayPlaybackStart(replay_log, seed)) {
+            terminalRestore();
+            printf("Can't replay key log file '%s'\n", replay_log);
+            return 1;
+        }
+
+        if (!terminalInitializeHeadless()) {
+            terminalRestore();
+            printf("Can't create a headless terminal for the replay\n");
+            return 1;
+        }
+
+        new_game = true;
+    }
+
     // Auto-restart of saved file
     if (argv[0] != CNIL) {
         // (void) strcpy(config::files::save_game, argv[0]);
@@ -102,6 +188,14 @@ int main(int argc, char *argv[]) {
     return 0;
 }
 
+static void printUsage() {
+    terminalRestore();
+
+    printf("Robert A. Koeneke's classic dungeon crawler.\n");
+    printf("Umoria %d.%d.%d is released under a GPL-3.0-or-later license.\n", CURRENT_VERSION_MAJOR, CURRENT_VERSION_MINOR, CURRENT_VERSION_PATCH);
+    printf("%s", usage_instructions);
+}
+
 static bool parseGameSeed(const char *argv, uint32_t &seed) {
     int value;
 
@@ -17,7 +17,7 @@ bool monsterIsVisible(Monster_t const &monster) {
     bool visible = false;
 
     Tile_t const &tile = dg.floor[monster.pos.y][monster.pos.x];
-    Creature_t const &creature = creatures_list[monster.creature_id];
+    CreatureBehaviour_t const &creature = creature_behaviours[monster.creature_id];
 
     if (tile.permanent_light || tile.temporary_light || ((py.running_tracker != 0) && monster.distance_from_player < 2 && py.carrying_light)) {
         // Normal sight.
@@ -46,7 +46,7 @@ void monsterUpdateVisibility(int monster_id) {
         if (game.wizard_mode) {
             // Wizard sight.
             visible = true;
-        } else if (los(py.pos, monster.pos)) {
+        } else if (los(py.pos, Coord_t{monster.pos.y, monster.pos.x})) {
             visible = monsterIsVisible(monster);
         }
     }
@@ -359,21 +359,17 @@ static void monsterConfuseOnAttack(Creature_t const &creature, Monster_t &monste
         printMessage("Your hands stop glowing.");
         py.flags.confuse_monster = false;
 
-        vtype_t msg = {'\0'};
-
         if (randomNumber(MON_MAX_LEVELS) < creature.level || ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
-            (void) snprintf(msg, 80, "%sis unaffected.", monster_name);
+            printMessageFormatted("%sis unaffected.", monster_name);
         } else {
-            (void) snprintf(msg, 80, "%sappears confused.", monster_name);
             if (monster.confused_amount != 0u) {
                 monster.confused_amount += 3;
             } else {
                 monster.confused_amount = (uint8_t)(2 + randomNumber(16));
             }
+            printMessageFormatted("%sappears confused.", monster_name);
         }
 
-        printMessage(msg);
-
         if (visible && !game.character_is_dead && randomNumber(4) == 1) {
             creature_recall[monster.creature_id].defenses |= creature.defenses & config::monsters::defense::CD_NO_SLEEP;
         }
@@ -540,7 +536,7 @@ static void monsterOpenDoor(Tile_t &tile, int16_t monster_hp, uint32_t move_bits
 }
 
 static void glyphOfWardingProtection(uint16_t creature_id, uint32_t move_bits, bool &do_move, bool &do_turn, Coord_t coord) {
-    if (randomNumber(config::treasure::OBJECTS_RUNE_PROTECTION) < creatures_list[creature_id].level) {
+    if (randomNumber(config::treasure::OBJECTS_RUNE_PROTECTION) < creature_behaviours[creature_id].level) {
         if (coord.y == py.pos.y && coord.x == py.pos.x) {
             printMessage("The rune of protection is broken!");
         }
@@ -625,7 +621,7 @@ static void makeMove(int monster_id, int *directions, uint32_t &rcmove) {
     bool do_move = false;
 
     Monster_t &monster = monsters[monster_id];
-    uint32_t move_bits = creatures_list[monster.creature_id].movement;
+    uint32_t move_bits = creature_behaviours[monster.creature_id].movement;
 
     // Up to 5 attempts at moving, give up.
     Coord_t coord = Coord_t{0, 0};
@@ -681,7 +677,7 @@ static bool monsterCanCastSpells(Monster_t const &monster, uint32_t spells) {
     bool within_range = monster.distance_from_player <= config::monsters::MON_MAX_SPELL_CAST_DISTANCE;
 
     // Must have unobstructed Line-Of-Sight
-    bool unobstructed = los(py.pos, monster.pos);
+    bool unobstructed = los(py.pos, Coord_t{monster.pos.y, monster.pos.x});
 
     return within_range && unobstructed;
 }
@@ -791,13 +787,10 @@ void monsterExecuteCastingOfSpell(Monster_t &monster, int monster_id, int spell_
             if (py.misc.current_mana > 0) {
                 playerDisturb(1, 0);
 
-                vtype_t msg = {'\0'};
-                (void) snprintf(msg, 80, "%sdraws psychic energy from you!", monster_name);
-                printMessage(msg);
+                printMessageFormatted("%sdraws psychic energy from you!", monster_name);
 
                 if (monster.lit) {
-                    (void) snprintf(msg, 80, "%sappears healthier.", monster_name);
-                    printMessage(msg);
+                    printMessageFormatted("%sappears healthier.", monster_name);
                 }
 
                 int num = (randomNumber((int) level) >> 1) + 1;
@@ -852,12 +845,13 @@ static bool monsterCastSpell(int monster_id) {
     }
 
     Monster_t &monster = monsters[monster_id];
-    Creature_t const &creature = creatures_list[monster.creature_id];
 
-    if (!monsterCanCastSpells(monster, creature.spells)) {
+    if (!monsterCanCastSpells(monster, creature_behaviours[monster.creature_id].spells)) {
         return false;
     }
 
+    Creature_t const &creature = creatures_list[monster.creature_id];
+
     // Creature is going to cast a spell
 
     // Check to see if monster should be lit.
@@ -932,7 +926,7 @@ bool monsterMultiply(Coord_t coord, int creature_id, int monster_id) {
                 // Creature there already?
                 if (tile.creature_id > 1) {
                     // Some critters are cannibalistic!
-                    bool cannibalistic = (creatures_list[creature_id].movement & config::monsters::move::CM_EATS_OTHER) != 0;
+                    bool cannibalistic = (creature_behaviours[creature_id].movement & config::monsters::move::CM_EATS_OTHER) != 0;
 
                     // Check the experience level -CJS-
                     bool experienced = creatures_list[creature_id].kill_exp_value >= creatures_list[monsters[tile.creature_id].creature_id].kill_exp_value;
@@ -1067,7 +1061,7 @@ static void monsterMoveOutOfWall(Monster_t const &monster, int monster_id, uint3
 }
 
 // Undead only get confused from turn undead, so they should flee
-static void monsterMoveUndead(Creature_t const &creature, int monster_id, uint32_t &rcmove) {
+static void monsterMoveUndead(CreatureBehaviour_t const &creature, int monster_id, uint32_t &rcmove) {
     int directions[9];
     monsterGetMoveDirection(monster_id, directions);
 
@@ -1083,7 +1077,7 @@ static void monsterMoveUndead(Creature_t const &creature, int monster_id, uint32
     }
 }
 
-static void monsterMoveConfused(Creature_t const &creature, int monster_id, uint32_t &rcmove) {
+static void monsterMoveConfused(CreatureBehaviour_t const &creature, int monster_id, uint32_t &rcmove) {
     int directions[9];
 
     directions[0] = randomNumber(9);
@@ -1098,7 +1092,7 @@ static void monsterMoveConfused(Creature_t const &creature, int monster_id, uint
     }
 }
 
-static bool monsterDoMove(int monster_id, uint32_t &rcmove, Monster_t &monster, Creature_t const &creature) {
+static bool monsterDoMove(int monster_id, uint32_t &rcmove, Monster_t &monster, CreatureBehaviour_t const &creature) {
     // Creature is confused or undead turned?
     if (monster.confused_amount != 0u) {
         if ((creature.defenses & config::monsters::defense::CD_UNDEAD) != 0) {
@@ -1166,7 +1160,7 @@ static void monsterAttackWithoutMoving(int monster_id, uint32_t &rcmove, uint8_t
 // Move the critters about the dungeon -RAK-
 static void monsterMove(int monster_id, uint32_t &rcmove) {
     Monster_t &monster = monsters[monster_id];
-    Creature_t const &creature = creatures_list[monster.creature_id];
+    CreatureBehaviour_t const &creature = creature_behaviours[monster.creature_id];
 
     // Does the critter multiply?
     // rest could be negative, to be safe, only use mod with positive values.
@@ -1254,6 +1248,8 @@ static void memoryUpdateRecall(Monster_t const &monster, bool wake, bool ignore,
 
 static void monsterAttackingUpdate(Monster_t &monster, int monster_id, int moves) {
     for (int i = moves; i > 0; i--) {
+        CreatureBehaviour_t const &creature = creature_behaviours[monster.creature_id];
+
         bool wake = false;
         bool ignore = false;
 
@@ -1261,8 +1257,8 @@ static void monsterAttackingUpdate(Monster_t &monster, int monster_id, int moves
 
         // Monsters trapped in rock must be given a turn also,
         // so that they will die/dig out immediately.
-        if (monster.lit || monster.distance_from_player <= creatures_list[monster.creature_id].area_affect_radius ||
-            (((creatures_list[monster.creature_id].movement & config::monsters::move::CM_PHASE) == 0u) && dg.floor[monster.pos.y][monster.pos.x].feature_id >= MIN_CAVE_WALL)) {
+        if (monster.lit || monster.distance_from_player <= creature.area_affect_radius ||
+            (((creature.movement & config::monsters::move::CM_PHASE) == 0u) && dg.floor[monster.pos.y][monster.pos.x].feature_id >= MIN_CAVE_WALL)) {
             if (monster.sleep_count > 0) {
                 if (py.flags.aggravate) {
                     monster.sleep_count = 0;
@@ -1285,7 +1281,7 @@ static void monsterAttackingUpdate(Monster_t &monster, int monster_id, int moves
 
             if (monster.stunned_amount != 0) {
                 // NOTE: Balrog = 100*100 = 10000, it always recovers instantly
-                if (randomNumber(5000) < creatures_list[monster.creature_id].level * creatures_list[monster.creature_id].level) {
+                if (randomNumber(5000) < creature.level * creature.level) {
                     monster.stunned_amount = 0;
                 } else {
                     monster.stunned_amount--;
@@ -1293,9 +1289,7 @@ static void monsterAttackingUpdate(Monster_t &monster, int monster_id, int moves
 
                 if (monster.stunned_amount == 0) {
                     if (monster.lit) {
-                        vtype_t msg = {'\0'};
-                        (void) snprintf(msg, 80, "The %s ", creatures_list[monster.creature_id].name);
-                        printMessage(strcat(msg, "recovers and glares at you."));
+                        printMessageFormatted("The %s recovers and glares at you.", creatures_list[monster.creature_id].name);
                     }
                 }
             }
@@ -1311,8 +1305,14 @@ static void monsterAttackingUpdate(Monster_t &monster, int monster_id, int moves
 
 // Creatures movement and attacking are done from here -RAK-
 void updateMonsters(bool attack) {
+    PROFILE_SCOPE(UpdateMonsters);
+
     // Process the monsters
     for (int id = next_free_monster_id - 1; id >= config::monsters::MON_MIN_INDEX_ID && !game.character_is_dead; id--) {
+        if (monsterScheduleSkip(id)) {
+            continue;
+        }
+
         Monster_t &monster = monsters[id];
 
         // Get rid of an eaten/breathed on monster.  Note: Be sure not to
@@ -1325,6 +1325,11 @@ void updateMonsters(bool attack) {
 
         monster.distance_from_player = (uint8_t) coordDistanceBetween(py.pos, Coord_t{monster.pos.y, monster.pos.x});
 
+        // Too far away to notice the player, or be noticed, so nothing to do.
+        if (monsterScheduleParkIfDormant(id)) {
+            continue;
+        }
+
         // Attack is argument passed to CREATURE
         if (attack) {
             int moves = monsterMovementRate(monster.speed);
@@ -1351,6 +1356,8 @@ void updateMonsters(bool attack) {
 // Decreases monsters hit points and deletes monster if needed.
 // (Picking on my babies.) -RAK-
 int monsterTakeHit(int monster_id, int damage) {
+    monsterScheduleWake(monster_id);
+
     Monster_t &monster = monsters[monster_id];
     Creature_t const &creature = creatures_list[monster.creature_id];
 
@@ -1492,15 +1499,17 @@ uint32_t monsterDeath(Coord_t coord, uint32_t flags) {
     return return_flags | number_of_items;
 }
 
-void printMonsterActionText(const std::string &name, const std::string &action) {
-    printMessage((name + " " + action).c_str());
+void printMonsterActionText(const char *name, const char *action) {
+    printMessageFormatted("%s %s", name, action);
 }
 
-std::string monsterNameDescription(const std::string &real_name, bool is_lit) {
+// Writes "The <name>", or "It" for an unseen monster, into a vtype_t.
+void monsterNameDescription(char *name, const char *real_name, bool is_lit) {
     if (is_lit) {
-        return "The " + real_name;
+        (void) snprintf(name, MORIA_MESSAGE_SIZE, "The %s", real_name);
+    } else {
+        (void) strcpy(name, "It");
     }
-    return "It";
 }
 
 // Sleep creatures adjacent to player -RAK-
@@ -1518,7 +1527,8 @@ bool monsterSleep(Coord_t coord) {
             Monster_t &monster = monsters[monster_id];
             Creature_t const &creature = creatures_list[monster.creature_id];
 
-            auto name = monsterNameDescription(creature.name, monster.lit);
+            vtype_t name = {'\0'};
+            monsterNameDescription(name, creature.name, monster.lit);
 
             if (randomNumber(MON_MAX_LEVELS) < creature.level || ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
                 if (monster.lit && ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
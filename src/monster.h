@@ -5,15 +5,16 @@
 
 #pragma once
 
-// Monster_t is created for any living monster found on the current dungeon level
-typedef struct {
+// Monster_t is created for any living monster found on the current dungeon level.
+// It is kept to 16 bytes, so that four monsters share a cache line.
+typedef struct alignas(16) {
     int16_t hp;           // Hit points
     int16_t sleep_count;  // Inactive counter
     int16_t speed;        // Movement speed
     uint16_t creature_id; // Pointer into creature
 
-    // Note: fy, fx, and cdis constrain dungeon size to less than 256 by 256
-    Coord_t pos;                  // (y,x) Pointer into map
+    // Note: pos and distance_from_player constrain dungeon size to less than 256 by 256
+    PackedCoord_t pos;            // (y,x) Pointer into map
     uint8_t distance_from_player; // Current distance from player
 
     bool lit;
@@ -21,6 +22,8 @@ typedef struct {
     uint8_t confused_amount;
 } Monster_t;
 
+static_assert(sizeof(Monster_t) == 16, "Monster_t should fill a quarter of a cache line");
+
 // Creature_t is a base data object.
 // Holds the base game data for any given creature in the game such
 // as: Kobold, Orc, Giant Red Ant, Quasit, Young Black Dragon, etc.
@@ -41,6 +44,20 @@ typedef struct {
     int color;                  // Color
 } Creature_t;
 
+// CreatureBehaviour_t holds the Creature_t fields needed by every monster
+// on every turn. creature_behaviours[] is made from creatures_list[] at
+// compile time, and being 16 bytes a creature, updateMonsters() reads a
+// good deal less memory than it would from the 40 byte Creature_t.
+typedef struct {
+    uint32_t movement;          // Bit field
+    uint32_t spells;            // Creature spells
+    uint16_t defenses;          // Bit field
+    uint8_t sleep_counter;      // Inactive counter / 10
+    uint8_t area_affect_radius; // Area affect radius
+    uint8_t speed;              // Movement speed+10
+    uint8_t level;              // Level of creature
+} CreatureBehaviour_t;
+
 // MonsterAttack_t is a base data object.
 // Holds the data for a monster's attack and damage type
 typedef struct {
@@ -60,9 +77,10 @@ constexpr uint8_t MON_MAX_LEVELS = 40;         // Maximum level of creatures
 constexpr uint8_t MON_MAX_ATTACKS = 4;         // Max num attacks (used in mons memory) -CJS-
 
 extern int hack_monptr;
-extern Creature_t creatures_list[MON_MAX_CREATURES];
+extern Creature_t const creatures_list[MON_MAX_CREATURES];
+extern CreatureBehaviour_t const (&creature_behaviours)[MON_MAX_CREATURES];
 extern Monster_t monsters[MON_TOTAL_ALLOCATIONS];
-extern int16_t monster_levels[MON_MAX_LEVELS + 1];
+extern int16_t const (&monster_levels)[MON_MAX_LEVELS + 1];
 extern MonsterAttack_t monster_attacks[MON_ATTACK_TYPES];
 extern Monster_t blank_monster;
 extern int16_t next_free_monster_id;
@@ -74,14 +92,22 @@ bool monsterMultiply(Coord_t coord, int creature_id, int monster_id);
 void updateMonsters(bool attack);
 uint32_t monsterDeath(Coord_t coord, uint32_t flags);
 int monsterTakeHit(int monster_id, int damage);
-void printMonsterActionText(const std::string &name, const std::string &action);
-std::string monsterNameDescription(const std::string &real_name, bool is_lit);
+void printMonsterActionText(const char *name, const char *action);
+void monsterNameDescription(char *name, const char *real_name, bool is_lit);
 bool monsterSleep(Coord_t coord);
 
 // monster management
 bool compactMonsters();
+int monsterGetOneSuitableForLevel(int level);
 bool monsterPlaceNew(Coord_t coord, int creature_id, bool sleeping);
 void monsterPlaceWinning();
 void monsterPlaceNewWithinDistance(int number, int distance_from_source, bool sleeping);
 bool monsterSummon(Coord_t &coord, bool sleeping);
 bool monsterSummonUndead(Coord_t &coord);
+
+// monster activity scheduling
+bool monsterScheduleSkip(int id);
+bool monsterScheduleParkIfDormant(int id);
+void monsterScheduleWake(int id);
+void monsterScheduleSyncDistances();
+void monsterScheduleReset();
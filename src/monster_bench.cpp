@@ -0,0 +1,158 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// umoria-monster-bench: time the monster turns, for tuning updateMonsters()
+
+#include "headers.h"
+
+#include <chrono>
+
+static const char *usage_instructions = R"(
+Usage:
+    umoria-monster-bench [OPTIONS]
+
+Makes a dungeon level, walls the player in so that nothing can reach or
+see them, and fills the surrounding area with awake monsters. It then
+times updateMonsters() for a number of game turns.
+
+Options:
+    -n NUMBER    Game turns to run (default: 20000)
+    -m NUMBER    Awake monsters near the player (default: 123, a full
+                 monster list)
+    -d DEPTH     Dungeon depth (default: 20)
+    -s NUMBER    Seed (default: 1)
+    -h           Display this message
+)";
+
+// Reads the NUMBER following an option, returning false if there is not a valid one.
+static bool parseNumber(int &argc, char **&argv, int &number) {
+    if (argv[1] == nullptr || !stringToNumber(argv[1], number) || number < 1) {
+        return false;
+    }
+
+    --argc;
+    ++argv;
+
+    return true;
+}
+
+// Granite around the player, so the monsters keep trying to reach them,
+// without any attacks or messages which would wait for a key press.
+static void benchWallInPlayer() {
+    for (int y = py.pos.y - 1; y <= py.pos.y + 1; y++) {
+        for (int x = py.pos.x - 1; x <= py.pos.x + 1; x++) {
+            Tile_t &tile = dg.floor[y][x];
+
+            if (y == py.pos.y && x == py.pos.x) {
+                continue;
+            }
+
+            if (tile.creature_id > 1) {
+                dungeonDeleteMonster(tile.creature_id);
+            }
+
+            tile.feature_id = TILE_BOUNDARY_WALL;
+        }
+    }
+}
+
+static int benchMonsterCount() {
+    return next_free_monster_id - config::monsters::MON_MIN_INDEX_ID;
+}
+
+static void benchPlaceMonsters(int count, int depth) {
+    auto near_player = [](Coord_t const &coord) {
+        Tile_t const &tile = dg.floor[coord.y][coord.x];
+
+        return tile.feature_id <= MAX_OPEN_SPACE && tile.creature_id == 0 && coordDistanceBetween(py.pos, coord) <= config::monsters::MON_MAX_SIGHT;
+    };
+
+    Coord_t coord = Coord_t{0, 0};
+
+    while (benchMonsterCount() < count && dungeonPickRandomTile(coord, 1, near_player)) {
+        if (!monsterPlaceNew(coord, monsterGetOneSuitableForLevel(depth), false)) {
+            break;
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int turns = 20000;
+    int monster_count = MON_TOTAL_ALLOCATIONS - config::monsters::MON_MIN_INDEX_ID;
+    int depth = 20;
+    int seed = 1;
+
+    for (--argc, ++argv; argc > 0; --argc, ++argv) {
+        bool valid = true;
+
+        if (strcmp(argv[0], "-n") == 0) {
+            valid = parseNumber(argc, argv, turns);
+        } else if (strcmp(argv[0], "-m") == 0) {
+            valid = parseNumber(argc, argv, monster_count);
+        } else if (strcmp(argv[0], "-d") == 0) {
+            valid = parseNumber(argc, argv, depth);
+        } else if (strcmp(argv[0], "-s") == 0) {
+            valid = parseNumber(argc, argv, seed);
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            fprintf(stderr, "%s", usage_instructions);
+            return 1;
+        }
+    }
+
+    if (depth > MON_MAX_LEVELS || monster_count > MON_TOTAL_ALLOCATIONS - config::monsters::MON_MIN_INDEX_ID) {
+        fprintf(stderr, "Depth must be up to %d, and monsters up to %d\n", MON_MAX_LEVELS, MON_TOTAL_ALLOCATIONS - config::monsters::MON_MIN_INDEX_ID);
+        return 1;
+    }
+
+    if (!terminalInitializeHeadless()) {
+        fprintf(stderr, "Can't create a headless terminal\n");
+        return 1;
+    }
+
+    setRandomSeed((uint32_t) seed);
+    levelTablesInitialize();
+    playerInitializeBaseExperienceLevels();
+
+    py.misc.level = (int16_t) depth;
+    py.misc.max_hp = SHRT_MAX;
+    game.character_generated = true;
+
+    dg.current_level = (int16_t) depth;
+    generateCave();
+
+    benchWallInPlayer();
+    benchPlaceMonsters(monster_count, depth);
+
+    uint64_t monster_turns = 0;
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+
+    for (int turn = 0; turn < turns; turn++) {
+        py.misc.current_hp = SHRT_MAX;
+        game.character_is_dead = false;
+        message_ready_to_print = false;
+
+        monster_turns += (uint64_t) benchMonsterCount();
+
+        auto start = std::chrono::steady_clock::now();
+        updateMonsters(true);
+        elapsed += std::chrono::steady_clock::now() - start;
+    }
+
+    terminalRestore();
+
+    auto nanoseconds = (double) std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    printf("turns: %d\n", turns);
+    printf("monsters: %.1f on average\n", (double) monster_turns / turns);
+    printf("time: %.3f ms\n", nanoseconds / 1e6);
+    printf("per turn: %.0f ns\n", nanoseconds / turns);
+    printf("per monster: %.1f ns\n", nanoseconds / (double) monster_turns);
+
+    return 0;
+}
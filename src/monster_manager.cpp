@@ -8,16 +8,19 @@
 #include "headers.h"
 
 Monster_t monsters[MON_TOTAL_ALLOCATIONS];
-int16_t monster_levels[MON_MAX_LEVELS + 1];
 
 // Values for a blank monster
-Monster_t blank_monster = {0, 0, 0, 0, Coord_t{0, 0}, 0, false, 0, 0};
+Monster_t blank_monster = {0, 0, 0, 0, PackedCoord_t{0, 0}, 0, false, 0, 0};
 
 int16_t next_free_monster_id;   // ID for the next available monster ptr
 int16_t monster_multiply_total; // Total number of reproduction's of creatures
 
 // Returns a pointer to next free space -RAK-
 // Returns -1 if could not allocate a monster.
+//
+// The monster list is always kept packed: dungeonDeleteMonsterRecord() moves
+// the last monster into the freed slot, so the free slots are simply those
+// from `next_free_monster_id` onwards, and both allocating and deleting are O(1).
 static int popm() {
     if (next_free_monster_id == MON_TOTAL_ALLOCATIONS) {
         if (!compactMonsters()) {
@@ -126,7 +129,7 @@ void monsterPlaceWinning() {
 // Return a monster suitable to be placed at a given level. This
 // makes high level monsters (up to the given level) slightly more
 // common than low level monsters at any given level. -CJS-
-static int monsterGetOneSuitableForLevel(int level) {
+int monsterGetOneSuitableForLevel(int level) {
     if (level == 0) {
         return randomNumber(monster_levels[0]) - 1;
     }
@@ -135,28 +138,8 @@ static int monsterGetOneSuitableForLevel(int level) {
         level = MON_MAX_LEVELS;
     }
 
-    if (randomNumber(config::monsters::MON_CHANCE_OF_NASTY) == 1) {
-        auto abs_distribution = (int) std::abs((std::intmax_t) randomNumberNormalDistribution(0, 4));
-        level += abs_distribution + 1;
-        if (level > MON_MAX_LEVELS) {
-            level = MON_MAX_LEVELS;
-        }
-    } else {
-        // This code has been added to make it slightly more likely to get
-        // the higher level monsters. Originally a uniform distribution over
-        // all monsters of level less than or equal to the dungeon level.
-        // This distribution makes a level n monster occur approx 2/n% of the
-        // time on level n, and 1/n*n% are 1st level.
-        int num = monster_levels[level] - monster_levels[0];
-        int i = randomNumber(num) - 1;
-        int j = randomNumber(num) - 1;
-        if (j > i) {
-            i = j;
-        }
-        level = creatures_list[i + monster_levels[0]].level;
-    }
-
-    return randomNumber(monster_levels[level] - monster_levels[level - 1]) - 1 + monster_levels[level - 1];
+    // See level_tables.cpp for how likely each monster is
+    return levelTablesPickMonster(level);
 }
 
 // Allocates a random monster -RAK-
@@ -164,13 +147,14 @@ void monsterPlaceNewWithinDistance(int number, int distance_from_source, bool sl
     Coord_t position = Coord_t{0, 0};
 
     for (int i = 0; i < number; i++) {
-        do {
-            position.y = randomNumber(dg.height - 2);
-            position.x = randomNumber(dg.width - 2);
-        } while (dg.floor[position.y][position.x].feature_id >= MIN_CLOSED_SPACE || //
-                 dg.floor[position.y][position.x].creature_id != 0 ||               //
-                 coordDistanceBetween(position, py.pos) <= distance_from_source     //
-        );
+        bool found = dungeonPickRandomTile(position, 1, [distance_from_source](Coord_t const &spot) {
+            Tile_t const &tile = dg.floor[spot.y][spot.x];
+            return tile.feature_id < MIN_CLOSED_SPACE && tile.creature_id == 0 && coordDistanceBetween(spot, py.pos) > distance_from_source;
+        });
+
+        if (!found) {
+            return;
+        }
 
         int l = monsterGetOneSuitableForLevel(dg.current_level);
 
@@ -250,9 +234,21 @@ bool monsterSummonUndead(Coord_t &coord) {
 bool compactMonsters() {
     printMessage("Compacting monsters...");
 
+    monsterScheduleSyncDistances();
+
     int cur_dis = 66;
     bool delete_any = false;
 
+    // A pass only does anything for monsters further away than `cur_dis`,
+    // so skip straight to the first pass that can find one.
+    int farthest = 0;
+    for (int i = next_free_monster_id - 1; i >= config::monsters::MON_MIN_INDEX_ID; i--) {
+        farthest = std::max(farthest, (int) monsters[i].distance_from_player);
+    }
+    while (cur_dis >= farthest && cur_dis >= 6) {
+        cur_dis -= 6;
+    }
+
     while (!delete_any) {
         for (int i = next_free_monster_id - 1; i >= config::monsters::MON_MIN_INDEX_ID; i--) {
             if (cur_dis < monsters[i].distance_from_player && randomNumber(3) == 1) {
@@ -0,0 +1,195 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Monster activity scheduling: skip monsters which can not do anything this turn
+
+#include "headers.h"
+
+// A monster which is not lit, is beyond both its area of affect and the
+// maximum sight distance, and is not stuck in a wall, does nothing at all
+// on its turn. Such a monster is "parked" and skipped by updateMonsters()
+// until the player could have moved close enough to matter.
+//
+// Player movement is tracked with an odometer (Chebyshev steps), and a
+// parked monster is put on a timer wheel keyed by the odometer reading at
+// which it may need to act again. As the distance between two points can
+// drop by no more than two for each step the player takes, a monster which
+// is `d` away, against a threshold of `t`, is safe for (d - t - 1) / 2 steps.
+//
+// Anything else which changes a parked monster - being hit, killed, moved,
+// lit up or having its record moved - must call monsterScheduleWake().
+//
+// A parked monster's `distance_from_player` is not updated, so to keep it
+// exactly as updateMonsters() would have left it, the player position at
+// the time the monster was skipped is kept, see monsterScheduleSyncDistances().
+
+static_assert(MON_TOTAL_ALLOCATIONS <= 128, "monster sets are 128 bits wide");
+
+constexpr int SCHEDULE_WHEEL_SIZE = 64;
+
+typedef struct {
+    uint64_t bits[2];
+} MonsterSet_t;
+
+static struct {
+    MonsterSet_t parked;
+    MonsterSet_t wheel[SCHEDULE_WHEEL_SIZE];
+
+    uint32_t odometer;       // Chebyshev steps the player has taken
+    uint32_t wheel_odometer; // odometer reading the wheel has been advanced to
+
+    // Recent player positions, and the one each parked monster was last skipped with
+    Coord_t player_positions[256];
+    uint8_t player_position_id;
+    uint8_t skipped_with[MON_TOTAL_ALLOCATIONS];
+} schedule = {};
+
+static bool setHas(MonsterSet_t const &set, int id) {
+    return (set.bits[id >> 6] & (1ULL << (id & 63))) != 0u;
+}
+
+static void setAdd(MonsterSet_t &set, int id) {
+    set.bits[id >> 6] |= 1ULL << (id & 63);
+}
+
+// Brings the distance of a parked monster up to date and makes it active again.
+static void scheduleActivate(int id) {
+    Monster_t &monster = monsters[id];
+    Coord_t player = schedule.player_positions[schedule.skipped_with[id]];
+
+    monster.distance_from_player = (uint8_t) coordDistanceBetween(player, Coord_t{monster.pos.y, monster.pos.x});
+
+    schedule.parked.bits[id >> 6] &= ~(1ULL << (id & 63));
+}
+
+static void scheduleActivateSet(MonsterSet_t const &set) {
+    for (int word = 0; word < 2; word++) {
+        uint64_t bits = set.bits[word] & schedule.parked.bits[word];
+
+        for (int bit = 0; bits != 0u; bit++, bits >>= 1) {
+            if ((bits & 1u) != 0u) {
+                scheduleActivate(word * 64 + bit);
+            }
+        }
+    }
+}
+
+// Record any player movement, waking the monsters it brings into range.
+static void scheduleObservePlayer() {
+    Coord_t &last = schedule.player_positions[schedule.player_position_id];
+
+    if (last.y == py.pos.y && last.x == py.pos.x) {
+        return;
+    }
+
+    int dy = std::abs(py.pos.y - last.y);
+    int dx = std::abs(py.pos.x - last.x);
+
+    schedule.player_position_id++;
+    schedule.player_positions[schedule.player_position_id] = py.pos;
+
+    schedule.odometer += (uint32_t) std::max(dy, dx);
+
+    uint32_t steps = schedule.odometer - schedule.wheel_odometer;
+
+    if (steps >= SCHEDULE_WHEEL_SIZE) {
+        scheduleActivateSet(schedule.parked);
+        for (auto &slot : schedule.wheel) {
+            slot = MonsterSet_t{};
+        }
+    } else {
+        for (uint32_t step = 1; step <= steps; step++) {
+            MonsterSet_t &slot = schedule.wheel[(schedule.wheel_odometer + step) % SCHEDULE_WHEEL_SIZE];
+            scheduleActivateSet(slot);
+            slot = MonsterSet_t{};
+        }
+    }
+
+    schedule.wheel_odometer = schedule.odometer;
+}
+
+// Called by updateMonsters() before processing a monster. Returns true when
+// the monster is parked, and so should be skipped.
+bool monsterScheduleSkip(int id) {
+    scheduleObservePlayer();
+
+    if (!setHas(schedule.parked, id)) {
+        return false;
+    }
+
+    schedule.skipped_with[id] = schedule.player_position_id;
+
+    return true;
+}
+
+// Called by updateMonsters() once the monster's distance has been updated.
+// Returns true if the monster has nothing to do this turn, parking it if it
+// is far enough away to stay that way for a while.
+bool monsterScheduleParkIfDormant(int id) {
+    Monster_t const &monster = monsters[id];
+    CreatureBehaviour_t const &creature = creature_behaviours[monster.creature_id];
+
+    if (monster.lit) {
+        return false;
+    }
+
+    // Monsters trapped in rock always get a turn, see monsterAttackingUpdate()
+    if ((creature.movement & config::monsters::move::CM_PHASE) == 0u && dg.floor[monster.pos.y][monster.pos.x].feature_id >= MIN_CAVE_WALL) {
+        return false;
+    }
+
+    int threshold = std::max((int) creature.area_affect_radius, (int) config::monsters::MON_MAX_SIGHT);
+    int distance = monster.distance_from_player;
+
+    if (distance <= threshold) {
+        return false;
+    }
+
+    int steps = std::min((distance - threshold - 1) / 2, SCHEDULE_WHEEL_SIZE - 1);
+
+    if (steps > 0) {
+        setAdd(schedule.parked, id);
+        setAdd(schedule.wheel[(schedule.odometer + steps) % SCHEDULE_WHEEL_SIZE], id);
+        schedule.skipped_with[id] = schedule.player_position_id;
+    }
+
+    return true;
+}
+
+void monsterScheduleWake(int id) {
+    if (setHas(schedule.parked, id)) {
+        scheduleActivate(id);
+    }
+}
+
+// Parked monsters keep the distance they were parked with, which is all
+// that is needed by code checking for monsters within sight. Call this
+// before using `distance_from_player` for anything else.
+void monsterScheduleSyncDistances() {
+    for (int word = 0; word < 2; word++) {
+        uint64_t bits = schedule.parked.bits[word];
+
+        for (int bit = 0; bits != 0u; bit++, bits >>= 1) {
+            if ((bits & 1u) == 0u) {
+                continue;
+            }
+
+            int id = word * 64 + bit;
+            Monster_t &monster = monsters[id];
+            Coord_t player = schedule.player_positions[schedule.skipped_with[id]];
+
+            monster.distance_from_player = (uint8_t) coordDistanceBetween(player, Coord_t{monster.pos.y, monster.pos.x});
+        }
+    }
+}
+
+// Forget all parked monsters, used when a new level is created.
+void monsterScheduleReset() {
+    schedule.parked = MonsterSet_t{};
+    for (auto &slot : schedule.wheel) {
+        slot = MonsterSet_t{};
+    }
+    schedule.wheel_odometer = schedule.odometer;
+}
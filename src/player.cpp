@@ -45,51 +45,22 @@ const char *playerGetGenderLabel() {
     return "Female";
 }
 
+// Tile offsets for each direction, as laid out on the numeric keypad.
+// 5 is the spot itself, and 0 is not a direction.
+Coord_t const direction_offsets[10] = {
+    {0, 0},
+    {1, -1}, {1, 0}, {1, 1},
+    {0, -1}, {0, 0}, {0, 1},
+    {-1, -1}, {-1, 0}, {-1, 1},
+};
+
 // Given direction "dir", returns new row, column location -RAK-
 bool playerMovePosition(int dir, Coord_t &coord) {
     Coord_t new_coord = Coord_t{0, 0};
 
-    switch (dir) {
-        case 1:
-            new_coord.y = coord.y + 1;
-            new_coord.x = coord.x - 1;
-            break;
-        case 2:
-            new_coord.y = coord.y + 1;
-            new_coord.x = coord.x;
-            break;
-        case 3:
-            new_coord.y = coord.y + 1;
-            new_coord.x = coord.x + 1;
-            break;
-        case 4:
-            new_coord.y = coord.y;
-            new_coord.x = coord.x - 1;
-            break;
-        case 5:
-            new_coord.y = coord.y;
-            new_coord.x = coord.x;
-            break;
-        case 6:
-            new_coord.y = coord.y;
-            new_coord.x = coord.x + 1;
-            break;
-        case 7:
-            new_coord.y = coord.y - 1;
-            new_coord.x = coord.x - 1;
-            break;
-        case 8:
-            new_coord.y = coord.y - 1;
-            new_coord.x = coord.x;
-            break;
-        case 9:
-            new_coord.y = coord.y - 1;
-            new_coord.x = coord.x + 1;
-            break;
-        default:
-            new_coord.y = 0;
-            new_coord.x = 0;
-            break;
+    if (dir >= 1 && dir <= 9) {
+        new_coord.y = coord.y + direction_offsets[dir].y;
+        new_coord.x = coord.x + direction_offsets[dir].x;
     }
 
     bool can_move = false;
@@ -1150,19 +1121,16 @@ static void playerAttackMonster(Coord_t coord) {
     int base_to_hit = playerCalculateBaseToHit(monster.lit, total_to_hit);
 
     int damage;
-    vtype_t msg = {'\0'};
 
     // Loop for number of blows, trying to hit the critter.
     // Note: blows will always be greater than 0 at the start of the loop -MRC-
     for (int i = blows; i > 0; i--) {
         if (!playerTestBeingHit(base_to_hit, (int) py.misc.level, total_to_hit, (int) creature.ac, PlayerClassLevelAdj::BTH)) {
-            (void) snprintf(msg, 80, "You miss %s.", name);
-            printMessage(msg);
+            printMessageFormatted("You miss %s.", name);
             continue;
         }
 
-        (void) snprintf(msg, 80, "You hit %s.", name);
-        printMessage(msg);
+        printMessageFormatted("You hit %s.", name);
 
         if (item.category_id != TV_NOTHING) {
             damage = diceRoll(item.damage);
@@ -1185,16 +1153,15 @@ static void playerAttackMonster(Coord_t coord) {
             printMessage("Your hands stop glowing.");
 
             if (((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0) || randomNumber(MON_MAX_LEVELS) < creature.level) {
-                (void) snprintf(msg, 80, "%s is unaffected.", name);
+                printMessageFormatted("%s is unaffected.", name);
             } else {
-                (void) snprintf(msg, 80, "%s appears confused.", name);
                 if (monster.confused_amount != 0u) {
                     monster.confused_amount += 3;
                 } else {
                     monster.confused_amount = (uint8_t)(2 + randomNumber(16));
                 }
+                printMessageFormatted("%s appears confused.", name);
             }
-            printMessage(msg);
 
             if (monster.lit && randomNumber(4) == 1) {
                 creature_recall[monster.creature_id].defenses |= creature.defenses & config::monsters::defense::CD_NO_SLEEP;
@@ -1203,8 +1170,7 @@ static void playerAttackMonster(Coord_t coord) {
 
         // See if we done it in.
         if (monsterTakeHit(creature_id, damage) >= 0) {
-            (void) snprintf(msg, 80, "You have slain %s.", name);
-            printMessage(msg);
+            printMessageFormatted("You have slain %s.", name);
             displayCharacterExperience();
 
             return;
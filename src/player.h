@@ -191,6 +191,8 @@ extern uint8_t blows_table[7][6];
 bool playerIsMale();
 void playerSetGender(bool is_male);
 const char *playerGetGenderLabel();
+extern Coord_t const direction_offsets[10];
+
 bool playerMovePosition(int dir, Coord_t &coord);
 void playerTeleport(int new_distance);
 bool playerNoLight();
@@ -257,7 +259,9 @@ void playerMove(int direction, bool do_pickup);
 
 // player_run.cpp
 void playerFindInitialize(int direction);
+void playerTravelInitialize(int direction);
 void playerRunAndFind();
+bool playerRunningInCorridor();
 void playerEndRunning();
 void playerAreaAffect(int direction, Coord_t coord);
 
@@ -281,6 +285,14 @@ int16_t playerDamageAdjustment();
 // player_throw.cpp
 void playerThrowItem();
 
+// player_travel.cpp
+void playerTravelTileSeen(Coord_t const &coord);
+void playerTravelResetLevel();
+int playerTravelNextDirection();
+bool playerTravelArrived();
+void playerTravel();
+void playerExplore();
+
 // player_traps.cpp
 void playerDisarmTrap();
 void chestTrap(Coord_t coord);
@@ -114,6 +114,7 @@ static int chome[] = {-1, 8, 9, 10, 7, -1, 11, 6, 5, 4};
 static bool find_openarea, find_breakright, find_breakleft;
 static int find_prevdir;
 static int find_direction; // Keep a record of which way we are going.
+static bool find_travel;   // Going where playerTravel() has found the way to.
 
 // Do we see a wall? Used in running. -CJS-
 static bool playerCanSeeDungeonWall(int dir, Coord_t coord) {
@@ -183,6 +184,13 @@ static void findRunningBreak(int dir, Coord_t coord) {
     }
 }
 
+// Erases the player symbol at the start of a run.
+static void playerRunEraseSelf() {
+    if (!py.temporary_light_only && !config::options::run_print_self) {
+        panelPutTile(caveGetTileSymbol(py.pos), caveGetTileColor(py.pos), py.pos);
+    }
+}
+
 void playerFindInitialize(int direction) {
     Coord_t coord = py.pos;
 
@@ -196,6 +204,7 @@ void playerFindInitialize(int direction) {
 
         find_breakright = false;
         find_breakleft = false;
+        find_travel = false;
 
         if (py.flags.blind < 1) {
             findRunningBreak(direction, coord);
@@ -208,9 +217,7 @@ void playerFindInitialize(int direction) {
     // in this case while moving, so the only problem is on the first turn
     // of find mode, when the initial position of the character must be erased.
     // Hence we must do the erasure here.
-    if (!py.temporary_light_only && !config::options::run_print_self) {
-        panelPutTile(caveGetTileSymbol(py.pos), caveGetTileColor(py.pos), py.pos);
-    }
+    playerRunEraseSelf();
 
     playerMove(direction, true);
 
@@ -219,13 +226,56 @@ void playerFindInitialize(int direction) {
     }
 }
 
+// Travelling stops once there, without looking around for a reason to
+// stop as a run does. Anything which disturbs the player still stops it.
+// A closed door on the way is opened by walking into it, which is only
+// done when not running.
+static void playerTravelStep(int direction) {
+    Coord_t coord = py.pos;
+
+    if (playerMovePosition(direction, coord)) {
+        uint8_t treasure_id = dg.floor[coord.y][coord.x].treasure_id;
+
+        if (treasure_id != 0 && game.treasure.list[treasure_id].category_id == TV_CLOSED_DOOR) {
+            playerEndRunning();
+        }
+    }
+
+    playerMove(direction, true);
+
+    if (py.running_tracker != 0 && playerTravelArrived()) {
+        playerEndRunning();
+    }
+}
+
+void playerTravelInitialize(int direction) {
+    py.running_tracker = 1;
+    find_travel = true;
+
+    playerRunEraseSelf();
+
+    playerTravelStep(direction);
+}
+
 void playerRunAndFind() {
+    if (find_travel) {
+        int direction = playerTravelNextDirection();
+
+        if (direction == 0) {
+            playerEndRunning();
+            game.player_free_turn = true;
+        } else {
+            playerTravelStep(direction);
+        }
+        return;
+    }
+
     uint8_t tracker = py.running_tracker;
 
     py.running_tracker++;
 
-    // prevent infinite loops in find mode, will stop after moving 100 times
-    if (tracker > 100) {
+    // prevent infinite loops in find mode, will stop after moving PLAYER_RUN_MAX_STEPS times
+    if (tracker > config::player::PLAYER_RUN_MAX_STEPS) {
         printMessage("You stop running to catch your breath.");
         playerEndRunning();
         return;
@@ -234,6 +284,23 @@ void playerRunAndFind() {
     playerMove(find_direction, true);
 }
 
+// Running along a corridor, or travelling, with no monsters in view. Nothing
+// the player needs to see changes until the run stops, so each step need
+// not be shown.
+bool playerRunningInCorridor() {
+    if (py.running_tracker == 0 || (find_openarea && !find_travel)) {
+        return false;
+    }
+
+    for (int id = next_free_monster_id - 1; id >= config::monsters::MON_MIN_INDEX_ID; id--) {
+        if (monsters[id].lit) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // Switch off the run flag - and get the light correct. -CJS-
 void playerEndRunning() {
     if (py.running_tracker == 0) {
@@ -331,7 +398,7 @@ static bool areaAffectStopLookingAtSquares(int i, int dir, int new_dir, Coord_t
 
 // Determine the next direction for a run, or if we should stop. -CJS-
 void playerAreaAffect(int direction, Coord_t coord) {
-    if (py.flags.blind >= 1) {
+    if (py.flags.blind >= 1 || find_travel) {
         return;
     }
 
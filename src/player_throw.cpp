@@ -136,7 +136,7 @@ static void inventoryDropOrThrowItem(Coord_t coord, Inventory_t *item) {
 
     if (flag) {
         int cur_pos = popt();
-        dg.floor[position.y][position.x].treasure_id = (uint8_t) cur_pos;
+        treasurePlaceOnTile(position, cur_pos);
         game.treasure.list[cur_pos] = *item;
         dungeonLiteSpot(position);
     } else {
@@ -195,7 +195,6 @@ void playerThrowItem() {
     while (!flag) {
         (void) playerMovePosition(dir, coord);
         current_distance++;
-        dungeonLiteSpot(old_coord);
 
         if (current_distance > tdis) {
             flag = true;
@@ -207,6 +206,9 @@ void playerThrowItem() {
             if (tile.creature_id > 1) {
                 flag = true;
 
+                // show the object reaching the monster
+                animationPlay();
+
                 Monster_t const &m_ptr = monsters[tile.creature_id];
 
                 tbth -= current_distance;
@@ -261,12 +263,15 @@ void playerThrowItem() {
                 // do not test tile.field_mark here
 
                 if (coordInsidePanel(coord) && py.flags.blind < 1 && (tile.temporary_light || tile.permanent_light)) {
-                    panelPutTile(tile_char, game_objects[thrown_item.id].color, coord);
-                    putQIO(); // show object moving
+                    animationAddStep(coord, tile_char, game_objects[thrown_item.id].color);
                 }
             }
         } else {
             flag = true;
+
+            // show the object flying until it lands
+            animationPlay();
+
             inventoryDropOrThrowItem(old_coord, &thrown_item);
         }
 
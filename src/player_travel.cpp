@@ -0,0 +1,359 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Travel to a remembered place, or explore, along the shortest known way
+
+#include "headers.h"
+
+#include <algorithm>
+
+constexpr int16_t TRAVEL_UNREACHABLE = -1;
+
+// The tiles the player has seen on this level, and the frontier: seen
+// floors and doors next to tiles they have not seen, which are where
+// exploring goes. Both are kept up to date as tiles are lit, so nothing
+// needs to look over the whole level to find them.
+static bool travel_seen[MAX_HEIGHT][MAX_WIDTH];
+static bool travel_frontier[MAX_HEIGHT][MAX_WIDTH];
+static std::vector<Coord_t> travel_frontier_tiles;
+
+// Steps from each tile to the nearest place being travelled to. For travel
+// to a symbol it is only worked out again when another symbol is chosen,
+// or the map the player knows of has changed. Exploring works it out
+// again every step, as the frontier moves with the player.
+static int16_t travel_distances[MAX_HEIGHT][MAX_WIDTH];
+static Coord_t travel_queue[MAX_HEIGHT * MAX_WIDTH];
+static char travel_symbol = '\0';
+static uint32_t travel_map_hash = 0;
+static bool travel_exploring = false;
+
+static bool travelTileOnLevel(int y, int x) {
+    return y >= 0 && y < dg.height && x >= 0 && x < dg.width;
+}
+
+// The symbol of the object the player remembers on a tile, or 0 for none.
+static char travelRememberedSymbol(Tile_t const &tile) {
+    if (tile.treasure_id == 0 || (!tile.permanent_light && !tile.field_mark)) {
+        return '\0';
+    }
+
+    Inventory_t const &item = game.treasure.list[tile.treasure_id];
+
+    if (item.category_id == TV_INVIS_TRAP) {
+        return '\0';
+    }
+
+    return item.sprite;
+}
+
+// Known traps and store entrances are only walked onto when travelling to them.
+static bool travelTileWalkable(Coord_t const &coord) {
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
+
+    if (!travel_seen[coord.y][coord.x] || tile.feature_id > MAX_OPEN_SPACE) {
+        return false;
+    }
+
+    if (tile.treasure_id == 0) {
+        return true;
+    }
+
+    int category_id = game.treasure.list[tile.treasure_id].category_id;
+
+    return category_id != TV_VIS_TRAP && category_id != TV_STORE_DOOR;
+}
+
+// Closed doors are explored through by opening them.
+static bool travelTileExplorable(Coord_t const &coord) {
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
+
+    if (tile.treasure_id != 0 && game.treasure.list[tile.treasure_id].category_id == TV_CLOSED_DOOR) {
+        return true;
+    }
+
+    return travelTileWalkable(coord);
+}
+
+static void travelUpdateFrontier(Coord_t const &coord) {
+    bool frontier = false;
+
+    if (travel_seen[coord.y][coord.x] && travelTileExplorable(coord)) {
+        for (int y = coord.y - 1; y <= coord.y + 1; y++) {
+            for (int x = coord.x - 1; x <= coord.x + 1; x++) {
+                if (travelTileOnLevel(y, x) && !travel_seen[y][x]) {
+                    frontier = true;
+                }
+            }
+        }
+    }
+
+    if (frontier && !travel_frontier[coord.y][coord.x]) {
+        travel_frontier_tiles.push_back(coord);
+    }
+
+    travel_frontier[coord.y][coord.x] = frontier;
+}
+
+// Called for every tile lit or remembered. Seeing a tile can only change
+// whether it, and those next to it, are on the frontier.
+void playerTravelTileSeen(Coord_t const &coord) {
+    if (travel_seen[coord.y][coord.x]) {
+        return;
+    }
+
+    travel_seen[coord.y][coord.x] = true;
+
+    for (int y = coord.y - 1; y <= coord.y + 1; y++) {
+        for (int x = coord.x - 1; x <= coord.x + 1; x++) {
+            if (travelTileOnLevel(y, x)) {
+                travelUpdateFrontier(Coord_t{y, x});
+            }
+        }
+    }
+}
+
+// Starts the seen tiles again for a new level. A level brought back from
+// the cache, or a saved game, only has the tiles the player remembers, so
+// dark floors they have walked before are only seen again once lit.
+void playerTravelResetLevel() {
+    travel_symbol = '\0';
+    travel_exploring = false;
+    travel_frontier_tiles.clear();
+
+    Coord_t coord = Coord_t{0, 0};
+
+    for (coord.y = 0; coord.y < MAX_HEIGHT; coord.y++) {
+        for (coord.x = 0; coord.x < MAX_WIDTH; coord.x++) {
+            travel_seen[coord.y][coord.x] = false;
+            travel_frontier[coord.y][coord.x] = false;
+        }
+    }
+
+    for (coord.y = 0; coord.y < dg.height; coord.y++) {
+        for (coord.x = 0; coord.x < dg.width; coord.x++) {
+            Tile_t const &tile = dg.floor[coord.y][coord.x];
+
+            travel_seen[coord.y][coord.x] = tile.permanent_light || tile.field_mark;
+        }
+    }
+
+    for (coord.y = 0; coord.y < dg.height; coord.y++) {
+        for (coord.x = 0; coord.x < dg.width; coord.x++) {
+            travelUpdateFrontier(coord);
+        }
+    }
+}
+
+// FNV-1a over what the player knows of each tile: whether they can walk
+// on it, and the object they remember there.
+static uint32_t travelMapHash() {
+    uint32_t hash = 2166136261u;
+
+    Coord_t coord = Coord_t{0, 0};
+
+    for (coord.y = 0; coord.y < dg.height; coord.y++) {
+        for (coord.x = 0; coord.x < dg.width; coord.x++) {
+            auto known = (uint8_t) travelRememberedSymbol(dg.floor[coord.y][coord.x]);
+
+            if (travelTileWalkable(coord)) {
+                known ^= 0x80;
+            }
+
+            hash = (hash ^ known) * 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+// Breadth first from every tile travelled to, already in the queue, as all
+// steps take the same time, diagonal ones included.
+static void travelFindDistances(int tail) {
+    int head = 0;
+
+    while (head < tail) {
+        Coord_t from = travel_queue[head++];
+
+        for (int direction = 1; direction <= 9; direction++) {
+            Coord_t to = Coord_t{from.y + direction_offsets[direction].y, from.x + direction_offsets[direction].x};
+
+            if (direction == 5 || !travelTileOnLevel(to.y, to.x) || travel_distances[to.y][to.x] != TRAVEL_UNREACHABLE || !travelTileWalkable(to)) {
+                continue;
+            }
+
+            travel_distances[to.y][to.x] = (int16_t)(travel_distances[from.y][from.x] + 1);
+            travel_queue[tail++] = to;
+        }
+    }
+}
+
+static void travelClearDistances() {
+    for (auto &row : travel_distances) {
+        std::fill(std::begin(row), std::end(row), TRAVEL_UNREACHABLE);
+    }
+}
+
+static void travelFindDistancesToSymbol(char symbol) {
+    travelClearDistances();
+
+    int tail = 0;
+
+    Coord_t coord = Coord_t{0, 0};
+
+    for (coord.y = 0; coord.y < dg.height; coord.y++) {
+        for (coord.x = 0; coord.x < dg.width; coord.x++) {
+            if (travelRememberedSymbol(dg.floor[coord.y][coord.x]) == symbol) {
+                travel_distances[coord.y][coord.x] = 0;
+                travel_queue[tail++] = coord;
+            }
+        }
+    }
+
+    travelFindDistances(tail);
+}
+
+// Drops the tiles which have left the frontier, or were listed twice,
+// while starting the search from the rest.
+static void travelFindDistancesToFrontier(bool with_doors) {
+    travelClearDistances();
+
+    int tail = 0;
+
+    auto left_frontier = [&tail, with_doors](Coord_t const &coord) {
+        if (!travel_frontier[coord.y][coord.x] || travel_distances[coord.y][coord.x] == 0) {
+            return true;
+        }
+
+        // a trap may have been found there since it was seen
+        if (with_doors ? travelTileExplorable(coord) : travelTileWalkable(coord)) {
+            travel_distances[coord.y][coord.x] = 0;
+            travel_queue[tail++] = coord;
+        }
+
+        return false;
+    };
+
+    travel_frontier_tiles.erase(std::remove_if(travel_frontier_tiles.begin(), travel_frontier_tiles.end(), left_frontier), travel_frontier_tiles.end());
+
+    travelFindDistances(tail);
+}
+
+// The direction of the next step downhill on the distances, straight steps
+// first so that the way looks like one a player would take, or 0 when there
+// or no nearer tile is known.
+static int travelDownhillDirection() {
+    int16_t best = travel_distances[py.pos.y][py.pos.x];
+    int best_direction = 0;
+
+    for (int direction : {2, 8, 4, 6, 1, 3, 7, 9}) {
+        int16_t distance = travel_distances[py.pos.y + direction_offsets[direction].y][py.pos.x + direction_offsets[direction].x];
+
+        if (distance != TRAVEL_UNREACHABLE && (best == TRAVEL_UNREACHABLE || distance < best)) {
+            best = distance;
+            best_direction = direction;
+        }
+    }
+
+    return best_direction;
+}
+
+// Exploring only goes to a closed door when there is nowhere else left,
+// as it may be locked or stuck.
+int playerTravelNextDirection() {
+    if (!travel_exploring) {
+        return travelDownhillDirection();
+    }
+
+    travelFindDistancesToFrontier(false);
+
+    int direction = travelDownhillDirection();
+
+    if (direction == 0) {
+        travelFindDistancesToFrontier(true);
+        direction = travelDownhillDirection();
+    }
+
+    return direction;
+}
+
+// Exploring does not stop at the frontier, it goes on to the next one.
+bool playerTravelArrived() {
+    return !travel_exploring && travel_distances[py.pos.y][py.pos.x] == 0;
+}
+
+static bool travelCanSeeMap() {
+    if (py.flags.blind > 0 || playerNoLight()) {
+        printMessage("You can't see your map.");
+        return false;
+    }
+
+    return true;
+}
+
+// Travel to the nearest remembered object with a given symbol, such as a
+// staircase or store entrance, by running along the shortest known way.
+void playerTravel() {
+    game.player_free_turn = true;
+
+    if (!travelCanSeeMap()) {
+        return;
+    }
+
+    char symbol;
+    if (!getTileCharacter("Travel to which symbol? (e.g. < > or a store number)", symbol)) {
+        return;
+    }
+
+    travel_exploring = false;
+
+    uint32_t map_hash = travelMapHash();
+
+    if (symbol != travel_symbol || map_hash != travel_map_hash) {
+        travelFindDistancesToSymbol(symbol);
+
+        travel_symbol = symbol;
+        travel_map_hash = map_hash;
+    }
+
+    if (travel_distances[py.pos.y][py.pos.x] == 0) {
+        printMessage("You are already there.");
+        return;
+    }
+
+    int direction = playerTravelNextDirection();
+    if (direction == 0) {
+        printMessage("You don't know the way there.");
+        return;
+    }
+
+    game.player_free_turn = false;
+
+    playerTravelInitialize(direction);
+}
+
+// Run towards the nearest tile next to unexplored parts of the level,
+// until there are none left or something disturbs the player.
+void playerExplore() {
+    game.player_free_turn = true;
+
+    if (!travelCanSeeMap()) {
+        return;
+    }
+
+    // the distances are about to be for the frontier, not a symbol
+    travel_symbol = '\0';
+    travel_exploring = true;
+
+    int direction = playerTravelNextDirection();
+    if (direction == 0) {
+        travel_exploring = false;
+        printMessage("There is nowhere left to explore.");
+        return;
+    }
+
+    game.player_free_turn = false;
+
+    playerTravelInitialize(direction);
+}
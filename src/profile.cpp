@@ -0,0 +1,223 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Hot path timers and counters, for finding out where a game turn goes
+
+#include "headers.h"
+
+#ifdef UMORIA_PROFILING
+
+#include <atomic>
+
+// Call durations are bucketed by powers of two nanoseconds,
+// so the last bucket holds anything over about a second.
+constexpr int PROFILE_BUCKETS = 32;
+
+// Each thread gets its own counters, so timing a call never needs a lock.
+// Threads beyond this number are still timed, but not reported.
+constexpr int PROFILE_MAX_THREADS = 8;
+
+constexpr int PROFILE_ZONES = (int) ProfileZone::Count;
+
+typedef struct {
+    uint64_t calls;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t buckets[PROFILE_BUCKETS];
+} ProfileCounter_t;
+
+typedef struct {
+    ProfileCounter_t zones[PROFILE_ZONES];
+} ProfileBuffer_t;
+
+static ProfileBuffer_t profile_buffers[PROFILE_MAX_THREADS];
+static std::atomic<int> profile_threads{0};
+
+static ProfileBuffer_t *profileClaimBuffer() {
+    int id = profile_threads.fetch_add(1);
+
+    if (id < PROFILE_MAX_THREADS) {
+        return &profile_buffers[id];
+    }
+
+    static thread_local ProfileBuffer_t overflow;
+    return &overflow;
+}
+
+static thread_local ProfileBuffer_t *profile_buffer = profileClaimBuffer();
+
+static int profileBucket(uint64_t ns) {
+    int bucket = 0;
+
+    while (ns > 1 && bucket < PROFILE_BUCKETS - 1) {
+        ns >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+ProfileScope::~ProfileScope() {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started_at);
+    auto ns = (uint64_t) elapsed.count();
+
+    ProfileCounter_t &counter = profile_buffer->zones[(int) zone];
+
+    counter.calls++;
+    counter.total_ns += ns;
+    if (ns > counter.max_ns) {
+        counter.max_ns = ns;
+    }
+    counter.buckets[profileBucket(ns)]++;
+}
+
+static const char *profile_zone_names[PROFILE_ZONES] = {
+    "updateMonsters",
+    "los",
+    "dungeonLiteSpot",
+    "drawDungeonPanel",
+    "generateCave",
+    "svWrite",
+    "itemDescription",
+    "storeMaintenance",
+};
+
+// Adds up the counters from every thread.
+static ProfileCounter_t profileTotals(ProfileZone zone) {
+    ProfileCounter_t total{};
+
+    int threads = std::min((int) profile_threads, PROFILE_MAX_THREADS);
+
+    for (int i = 0; i < threads; i++) {
+        ProfileCounter_t const &counter = profile_buffers[i].zones[(int) zone];
+
+        total.calls += counter.calls;
+        total.total_ns += counter.total_ns;
+        total.max_ns = std::max(total.max_ns, counter.max_ns);
+
+        for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+            total.buckets[bucket] += counter.buckets[bucket];
+        }
+    }
+
+    return total;
+}
+
+// Bucket range as a short human readable duration, e.g. "512ns" or "4ms".
+static std::string profileBucketLabel(int bucket) {
+    uint64_t ns = (uint64_t) 1 << bucket;
+
+    if (ns < 1000) {
+        return std::to_string(ns) + "ns";
+    }
+    if (ns < 1000000) {
+        return std::to_string(ns / 1000) + "us";
+    }
+    if (ns < 1000000000) {
+        return std::to_string(ns / 1000000) + "ms";
+    }
+    return std::to_string(ns / 1000000000) + "s";
+}
+
+// Only buckets in this range are shown on screen, the rest are added to the ends.
+constexpr int PROFILE_DISPLAY_FIRST_BUCKET = 4;
+constexpr int PROFILE_DISPLAY_LAST_BUCKET = 26;
+
+// Shows a one line summary per zone, plus a sparkline of its histogram.
+void profileDisplay() {
+    static const char levels[] = " .:-=+*#%@";
+    constexpr int columns = PROFILE_DISPLAY_LAST_BUCKET - PROFILE_DISPLAY_FIRST_BUCKET + 1;
+
+    terminalSaveScreen();
+    clearScreen();
+
+    vtype_t line = {'\0'};
+    (void) snprintf(line, sizeof(line), "%-17s%9s%10s%9s%9s  %s", "Zone", "Calls", "Total ms", "Mean us", "Max us", "16ns..64ms");
+    putStringClearToEOL(line, Coord_t{1, 0});
+
+    for (int i = 0; i < PROFILE_ZONES; i++) {
+        ProfileCounter_t counter = profileTotals((ProfileZone) i);
+
+        uint64_t display[columns] = {};
+        uint64_t most = 0;
+        for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+            int column = std::min(std::max(bucket, PROFILE_DISPLAY_FIRST_BUCKET), PROFILE_DISPLAY_LAST_BUCKET) - PROFILE_DISPLAY_FIRST_BUCKET;
+            display[column] += counter.buckets[bucket];
+            most = std::max(most, display[column]);
+        }
+
+        char histogram[columns + 1] = {'\0'};
+        for (int column = 0; column < columns; column++) {
+            histogram[column] = levels[display[column] == 0 ? 0 : 1 + (display[column] * 8) / most];
+        }
+
+        (void) snprintf(line,
+                        sizeof(line),
+                        "%-17s%9lu%10.1f%9.1f%9.1f  %s",
+                        profile_zone_names[i],
+                        (unsigned long) counter.calls,
+                        (double) counter.total_ns / 1e6,
+                        counter.calls == 0 ? 0.0 : (double) counter.total_ns / (double) counter.calls / 1e3,
+                        (double) counter.max_ns / 1e3,
+                        histogram);
+        putStringClearToEOL(line, Coord_t{i + 3, 0});
+    }
+
+    waitForContinueKey(PROFILE_ZONES + 4);
+    terminalRestoreScreen();
+}
+
+// Writes the full histograms to stderr, called once the terminal has been restored.
+void profilePrintReport() {
+    bool header_printed = false;
+
+    for (int i = 0; i < PROFILE_ZONES; i++) {
+        ProfileCounter_t counter = profileTotals((ProfileZone) i);
+
+        if (counter.calls == 0) {
+            continue;
+        }
+
+        if (!header_printed) {
+            fprintf(stderr, "\nUmoria profile\n");
+            header_printed = true;
+        }
+
+        fprintf(stderr,
+                "\n%s: %lu calls, %.3f ms total, %.3f us mean, %.3f us max\n",
+                profile_zone_names[i],
+                (unsigned long) counter.calls,
+                (double) counter.total_ns / 1e6,
+                (double) counter.total_ns / (double) counter.calls / 1e3,
+                (double) counter.max_ns / 1e3);
+
+        uint64_t most = 0;
+        for (auto count : counter.buckets) {
+            most = std::max(most, count);
+        }
+
+        for (int bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+            uint64_t count = counter.buckets[bucket];
+            if (count == 0) {
+                continue;
+            }
+
+            std::string bar((size_t) (1 + (count * 49) / most), '#');
+            fprintf(stderr, "  >= %-6s %10lu %s\n", profileBucketLabel(bucket).c_str(), (unsigned long) count, bar.c_str());
+        }
+    }
+}
+
+#else
+
+void profileDisplay() {
+    printMessage("Profiling is not enabled in this build.");
+}
+
+void profilePrintReport() {
+    // nothing was recorded
+}
+
+#endif
@@ -0,0 +1,52 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+// Hot path instrumentation, enabled by building with `-DPROFILING=ON`.
+//
+// Place PROFILE_SCOPE(Zone) at the top of a function to count its calls and
+// time everything up to the end of the enclosing block. Without profiling
+// the macro expands to nothing, so it costs nothing in a normal build.
+
+enum class ProfileZone {
+    UpdateMonsters,
+    Los,
+    DungeonLiteSpot,
+    DrawDungeonPanel,
+    GenerateCave,
+    SaveWrite,
+    ItemDescription,
+    StoreMaintenance,
+    Count, // must be last
+};
+
+#ifdef UMORIA_PROFILING
+
+#include <chrono>
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileZone scope_zone) : zone(scope_zone), started_at(std::chrono::steady_clock::now()) {}
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+    ProfileZone zone;
+    std::chrono::steady_clock::time_point started_at;
+};
+
+#define PROFILE_SCOPE(zone) ProfileScope profile_scope_##zone(ProfileZone::zone)
+
+#else
+
+#define PROFILE_SCOPE(zone)
+
+#endif
+
+void profileDisplay();
+void profilePrintReport();
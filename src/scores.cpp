@@ -57,7 +57,7 @@ void recordNewHighScore() {
     (void) strcpy(new_entry.died_from, tmp);
 
     if ((highscore_fp = fopen(config::files::scores.c_str(), "rb+")) == nullptr) {
-        printMessage(("Error opening score file '" + config::files::scores + "'.").c_str());
+        printMessageFormatted("Error opening score file '%s'.", config::files::scores.c_str());
         printMessage(CNIL);
         return;
     }
@@ -172,7 +172,7 @@ void recordNewHighScore() {
 
 void showScoresScreen() {
     if ((highscore_fp = fopen(config::files::scores.c_str(), "rb")) == nullptr) {
-        printMessage(("Error opening score file '" + config::files::scores + "'.").c_str());
+        printMessageFormatted("Error opening score file '%s'.", config::files::scores.c_str());
         printMessage(CNIL);
         return;
     }
@@ -260,6 +260,7 @@ bool spellDetectInvisibleCreaturesWithinVicinity() {
         Monster_t &monster = monsters[id];
 
         if (coordInsidePanel(Coord_t{monster.pos.y, monster.pos.x}) && ((creatures_list[monster.creature_id].movement & config::monsters::move::CM_INVISIBLE) != 0u)) {
+            monsterScheduleWake(id);
             monster.lit = true;
 
             // works correctly even if hallucinating
@@ -431,6 +432,8 @@ bool spellIdentifyItem() {
 bool spellAggravateMonsters(int affect_distance) {
     bool aggravated = false;
 
+    monsterScheduleSyncDistances();
+
     for (int id = next_free_monster_id - 1; id >= config::monsters::MON_MIN_INDEX_ID; id--) {
         Monster_t &monster = monsters[id];
         monster.sleep_count = 0;
@@ -506,7 +509,7 @@ bool spellSurroundPlayerWithDoors() {
 
                 int free_id = popt();
                 tile.feature_id = TILE_BLOCKED_FLOOR;
-                tile.treasure_id = (uint8_t) free_id;
+                treasurePlaceOnTile(coord, free_id);
 
                 inventoryItemCopyTo(config::dungeon::objects::OBJ_CLOSED_DOOR, game.treasure.list[free_id]);
                 dungeonLiteSpot(coord);
@@ -563,6 +566,7 @@ bool spellDetectMonsters() {
         Monster_t &monster = monsters[id];
 
         if (coordInsidePanel(Coord_t{monster.pos.y, monster.pos.x}) && (creatures_list[monster.creature_id].movement & config::monsters::move::CM_INVISIBLE) == 0) {
+            monsterScheduleWake(id);
             monster.lit = true;
             detected = true;
 
@@ -594,7 +598,8 @@ static void spellLightLineTouchesMonster(int monster_id) {
     // light up and draw monster
     monsterUpdateVisibility(monster_id);
 
-    auto name = monsterNameDescription(creature.name, monster.lit);
+    vtype_t name = {'\0'};
+    monsterNameDescription(name, creature.name, monster.lit);
 
     if ((creature.defenses & config::monsters::defense::CD_LIGHT) != 0) {
         if (monster.lit) {
@@ -610,49 +615,45 @@ static void spellLightLineTouchesMonster(int monster_id) {
     }
 }
 
-// Leave a line of light in given dir, blue light can sometimes hurt creatures. -RAK-
-void spellLightLine(Coord_t coord, int direction) {
-    int distance = 0;
-    bool finished = false;
-
-    Coord_t tmp_coord = Coord_t{0, 0};
+// Lights up one tile of a line of light.
+static void spellLightLineTile(Coord_t coord) {
+    Tile_t &tile = dg.floor[coord.y][coord.x];
 
-    while (!finished) {
-        Tile_t &tile = dg.floor[coord.y][coord.x];
+    if (!tile.permanent_light && !tile.temporary_light) {
+        // set permanent_light so that dungeonLiteSpot will work
+        tile.permanent_light = true;
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            (void) playerMovePosition(direction, coord);
-            finished = true;
-            continue; // we're done here, break out of the loop
+        if (tile.feature_id == TILE_LIGHT_FLOOR) {
+            if (coordInsidePanel(coord)) {
+                dungeonLightRoom(coord);
+            }
+        } else {
+            dungeonLiteSpot(coord);
         }
+    }
 
-        if (!tile.permanent_light && !tile.temporary_light) {
-            // set permanent_light so that dungeonLiteSpot will work
-            tile.permanent_light = true;
+    // set permanent_light in case temporary_light was true above
+    tile.permanent_light = true;
 
-            // coord y/x need to be maintained, so copy them
-            tmp_coord.y = coord.y;
-            tmp_coord.x = coord.x;
+    if (tile.creature_id > 1) {
+        spellLightLineTouchesMonster((int) tile.creature_id);
+    }
+}
 
-            if (tile.feature_id == TILE_LIGHT_FLOOR) {
-                if (coordInsidePanel(tmp_coord)) {
-                    dungeonLightRoom(tmp_coord);
-                }
-            } else {
-                dungeonLiteSpot(tmp_coord);
-            }
-        }
+// Leave a line of light in given dir, blue light can sometimes hurt creatures. -RAK-
+void spellLightLine(Coord_t coord, int direction) {
+    if (dg.floor[coord.y][coord.x].feature_id >= MIN_CLOSED_SPACE) {
+        return;
+    }
 
-        // set permanent_light in case temporary_light was true above
-        tile.permanent_light = true;
+    // the line starts with the caster's own tile
+    spellLightLineTile(coord);
 
-        if (tile.creature_id > 1) {
-            spellLightLineTouchesMonster((int) tile.creature_id);
-        }
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-        // move must be at end because want to light up current tmp_coord
-        (void) playerMovePosition(direction, coord);
-        distance++;
+    for (int i = 0; i < path.open; i++) {
+        spellLightLineTile(path.tiles[i]);
     }
 }
 
@@ -669,48 +670,62 @@ void spellStarlite(Coord_t coord) {
     }
 }
 
-// Disarms all traps/chests in a given direction -RAK-
-bool spellDisarmAllInDirection(Coord_t coord, int direction) {
-    int distance = 0;
+// Disarms any trap or chest, and unlocks or finds any door, on a tile.
+static bool spellDisarmTile(Coord_t coord) {
+    Tile_t &tile = dg.floor[coord.y][coord.x];
+
+    if (tile.treasure_id == 0) {
+        return false;
+    }
+
     bool disarmed = false;
 
-    Tile_t *tile = nullptr;
+    Inventory_t &item = game.treasure.list[tile.treasure_id];
 
-    do {
-        tile = &dg.floor[coord.y][coord.x];
+    if (item.category_id == TV_INVIS_TRAP || item.category_id == TV_VIS_TRAP) {
+        if (dungeonDeleteObject(coord)) {
+            disarmed = true;
+        }
+    } else if (item.category_id == TV_CLOSED_DOOR) {
+        // Locked or jammed doors become merely closed.
+        item.misc_use = 0;
+    } else if (item.category_id == TV_SECRET_DOOR) {
+        tile.field_mark = true;
+        trapChangeVisibility(coord);
+        disarmed = true;
+    } else if (item.category_id == TV_CHEST && item.flags != 0) {
+        disarmed = true;
+        printMessage("Click!");
 
-        // note, must continue up to and including the first non open space,
-        // because secret doors have feature_id greater than MAX_OPEN_SPACE
-        if (tile->treasure_id != 0) {
-            Inventory_t &item = game.treasure.list[tile->treasure_id];
+        item.flags &= ~(config::treasure::chests::CH_TRAPPED | config::treasure::chests::CH_LOCKED);
+        item.special_name_id = SpecialNameIds::SN_UNLOCKED;
 
-            if (item.category_id == TV_INVIS_TRAP || item.category_id == TV_VIS_TRAP) {
-                if (dungeonDeleteObject(coord)) {
-                    disarmed = true;
-                }
-            } else if (item.category_id == TV_CLOSED_DOOR) {
-                // Locked or jammed doors become merely closed.
-                item.misc_use = 0;
-            } else if (item.category_id == TV_SECRET_DOOR) {
-                tile->field_mark = true;
-                trapChangeVisibility(coord);
-                disarmed = true;
-            } else if (item.category_id == TV_CHEST && item.flags != 0) {
-                disarmed = true;
-                printMessage("Click!");
+        spellItemIdentifyAndRemoveRandomInscription(item);
+    }
 
-                item.flags &= ~(config::treasure::chests::CH_TRAPPED | config::treasure::chests::CH_LOCKED);
-                item.special_name_id = SpecialNameIds::SN_UNLOCKED;
+    return disarmed;
+}
 
-                spellItemIdentifyAndRemoveRandomInscription(item);
-            }
-        }
+// Disarms all traps/chests in a given direction -RAK-
+bool spellDisarmAllInDirection(Coord_t coord, int direction) {
+    bool disarmed = spellDisarmTile(coord);
 
-        // move must be at end because want to light up current spot
-        (void) playerMovePosition(direction, coord);
+    if (dg.floor[coord.y][coord.x].feature_id > MAX_OPEN_SPACE) {
+        return disarmed;
+    }
 
-        distance++;
-    } while (distance <= config::treasure::OBJECT_BOLTS_MAX_RANGE && tile->feature_id <= MAX_OPEN_SPACE);
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
+
+    // note, must continue up to and including the first non open space,
+    // because secret doors have feature_id greater than MAX_OPEN_SPACE
+    int length = path.open < path.length ? path.open + 1 : path.length;
+
+    for (int i = 0; i < length; i++) {
+        if (spellDisarmTile(path.tiles[i])) {
+            disarmed = true;
+        }
+    }
 
     return disarmed;
 }
@@ -758,19 +773,16 @@ static void spellGetAreaAffectFlags(int spell_type, uint32_t &weapon_type, int &
     }
 }
 
-static void printBoltStrikesMonsterMessage(Creature_t const &creature, const std::string &bolt_name, bool is_lit) {
-    std::string monster_name;
+static void printBoltStrikesMonsterMessage(Creature_t const &creature, const char *bolt_name, bool is_lit) {
     if (is_lit) {
-        monster_name = "the " + std::string(creature.name);
+        printMessageFormatted("The %s strikes the %s.", bolt_name, creature.name);
     } else {
-        monster_name = "it";
+        printMessageFormatted("The %s strikes it.", bolt_name);
     }
-    std::string msg = "The " + bolt_name + " strikes " + monster_name + ".";
-    printMessage(msg.c_str());
 }
 
 // Light up, draw, and check for monster damage when Fire Bolt touches it.
-static void spellFireBoltTouchesMonster(Tile_t &tile, int damage, int harm_type, uint32_t weapon_id, const std::string &bolt_name) {
+static void spellFireBoltTouchesMonster(Tile_t &tile, int damage, int harm_type, uint32_t weapon_id, const char *bolt_name) {
     Monster_t const &monster = monsters[tile.creature_id];
     Creature_t const &creature = creatures_list[monster.creature_id];
 
@@ -798,7 +810,8 @@ static void spellFireBoltTouchesMonster(Tile_t &tile, int damage, int harm_type,
         }
     }
 
-    auto name = monsterNameDescription(creature.name, monster.lit);
+    vtype_t name = {'\0'};
+    monsterNameDescription(name, creature.name, monster.lit);
 
     if (monsterTakeHit((int) tile.creature_id, damage) >= 0) {
         printMonsterActionText(name, "dies in a fit of agony.");
@@ -831,47 +844,38 @@ int spellGetColor(int spell_type) {
 }
 
 // Shoot a bolt in a given direction -RAK-
-void spellFireBolt(Coord_t coord, int direction, int damage_hp, int spell_type, const std::string &spell_name) {
+void spellFireBolt(Coord_t coord, int direction, int damage_hp, int spell_type, const char *spell_name) {
     bool (*dummy)(Inventory_t *);
     int harm_type = 0;
     uint32_t weapon_type;
     spellGetAreaAffectFlags(spell_type, weapon_type, harm_type, &dummy);
 
-    Coord_t old_coord = Coord_t{0, 0};
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-    int distance = 0;
-    bool finished = false;
-
-    while (!finished) {
-        old_coord.y = coord.y;
-        old_coord.x = coord.x;
-        (void) playerMovePosition(direction, coord);
-
-        distance++;
-
-        Tile_t &tile = dg.floor[coord.y][coord.x];
-
-        dungeonLiteSpot(old_coord);
-
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue; // we're done here, break out of the loop
-        }
+    for (int i = 0; i < path.open; i++) {
+        Coord_t const &spot = path.tiles[i];
+        Tile_t &tile = dg.floor[spot.y][spot.x];
 
         if (tile.creature_id > 1) {
-            finished = true;
+            // show the bolt reaching the monster
+            animationPlay();
+
             spellFireBoltTouchesMonster(tile, damage_hp, harm_type, weapon_type, spell_name);
-        } else if (coordInsidePanel(coord) && py.flags.blind < 1) {
-            panelPutTile('*', spellGetColor(spell_type), coord);
+            return;
+        }
 
-            // show the bolt
-            putQIO();
+        if (coordInsidePanel(spot) && py.flags.blind < 1) {
+            animationAddStep(spot, '*', spellGetColor(spell_type));
         }
     }
+
+    // show the bolt, when it did not hit anything
+    animationPlay();
 }
 
-// Shoot a ball in a given direction.  Note that balls have an area affect. -RAK-
-void spellFireBall(Coord_t coord, int direction, int damage_hp, int spell_type, const std::string &spell_name) {
+// The ball explodes, hurting the monsters and destroying the objects around it.
+static void spellFireBallExplodes(Coord_t coord, int damage_hp, int spell_type, const char *spell_name) {
     int total_hits = 0;
     int total_kills = 0;
     int max_distance = 2;
@@ -881,133 +885,118 @@ void spellFireBall(Coord_t coord, int direction, int damage_hp, int spell_type,
     uint32_t weapon_type;
     spellGetAreaAffectFlags(spell_type, weapon_type, harm_type, &destroy);
 
-    Coord_t old_coord = Coord_t{0, 0};
-    Coord_t spot = Coord_t{0, 0};
-
-    int distance = 0;
-    bool finished = false;
-
-    while (!finished) {
-        old_coord.y = coord.y;
-        old_coord.x = coord.x;
-        (void) playerMovePosition(direction, coord);
-
-        distance++;
-
-        dungeonLiteSpot(old_coord);
+    DungeonArea_t area{};
+    dungeonAreaTiles(coord, max_distance, area);
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE) {
-            finished = true;
+    // The explosion.
+    for (int i = 0; i < area.length; i++) {
+        if (!dungeonAreaTileInSight(area, i)) {
             continue;
         }
 
-        Tile_t *tile = &dg.floor[coord.y][coord.x];
+        Coord_t const &spot = area.tiles[i];
+        Tile_t *tile = &dg.floor[spot.y][spot.x];
 
-        if (tile->feature_id >= MIN_CLOSED_SPACE || tile->creature_id > 1) {
-            finished = true;
+        if (tile->treasure_id != 0 && (*destroy)(&game.treasure.list[tile->treasure_id])) {
+            (void) dungeonDeleteObject(spot);
+        }
 
-            if (tile->feature_id >= MIN_CLOSED_SPACE) {
-                coord.y = old_coord.y;
-                coord.x = old_coord.x;
-            }
+        if (tile->feature_id <= MAX_OPEN_SPACE) {
+            if (tile->creature_id > 1) {
+                Monster_t const &monster = monsters[tile->creature_id];
+                Creature_t const &creature = creatures_list[monster.creature_id];
 
-            // The ball hits and explodes.
+                // lite up creature if visible, temp set permanent_light so that monsterUpdateVisibility works
+                bool saved_lit_status = tile->permanent_light;
+                tile->permanent_light = true;
+                monsterUpdateVisibility((int) tile->creature_id);
 
-            // The explosion.
-            for (int row = coord.y - max_distance; row <= coord.y + max_distance; row++) {
-                for (int col = coord.x - max_distance; col <= coord.x + max_distance; col++) {
-                    spot.y = row;
-                    spot.x = col;
+                total_hits++;
+                int damage = damage_hp;
 
-                    if (coordInBounds(spot) && coordDistanceBetween(coord, spot) <= max_distance && los(coord, spot)) {
-                        tile = &dg.floor[spot.y][spot.x];
+                if ((harm_type & creature.defenses) != 0) {
+                    damage = damage * 2;
+                    if (monster.lit) {
+                        creature_recall[monster.creature_id].defenses |= harm_type;
+                    }
+                } else if ((weapon_type & creature.spells) != 0u) {
+                    damage = damage / 4;
+                    if (monster.lit) {
+                        creature_recall[monster.creature_id].spells |= weapon_type;
+                    }
+                }
 
-                        if (tile->treasure_id != 0 && (*destroy)(&game.treasure.list[tile->treasure_id])) {
-                            (void) dungeonDeleteObject(spot);
-                        }
+                damage = (damage / (coordDistanceBetween(spot, coord) + 1));
 
-                        if (tile->feature_id <= MAX_OPEN_SPACE) {
-                            if (tile->creature_id > 1) {
-                                Monster_t const &monster = monsters[tile->creature_id];
-                                Creature_t const &creature = creatures_list[monster.creature_id];
-
-                                // lite up creature if visible, temp set permanent_light so that monsterUpdateVisibility works
-                                bool saved_lit_status = tile->permanent_light;
-                                tile->permanent_light = true;
-                                monsterUpdateVisibility((int) tile->creature_id);
-
-                                total_hits++;
-                                int damage = damage_hp;
-
-                                if ((harm_type & creature.defenses) != 0) {
-                                    damage = damage * 2;
-                                    if (monster.lit) {
-                                        creature_recall[monster.creature_id].defenses |= harm_type;
-                                    }
-                                } else if ((weapon_type & creature.spells) != 0u) {
-                                    damage = damage / 4;
-                                    if (monster.lit) {
-                                        creature_recall[monster.creature_id].spells |= weapon_type;
-                                    }
-                                }
-
-                                damage = (damage / (coordDistanceBetween(spot, coord) + 1));
-
-                                if (monsterTakeHit((int) tile->creature_id, damage) >= 0) {
-                                    total_kills++;
-                                }
-                                tile->permanent_light = saved_lit_status;
-                            } else if (coordInsidePanel(spot) && py.flags.blind < 1) {
-                                panelPutTile('*', spellGetColor(spell_type), spot);
-                            }
-                        }
-                    }
+                if (monsterTakeHit((int) tile->creature_id, damage) >= 0) {
+                    total_kills++;
                 }
+                tile->permanent_light = saved_lit_status;
+            } else if (coordInsidePanel(spot) && py.flags.blind < 1) {
+                panelPutTile('*', spellGetColor(spell_type), spot);
             }
+        }
+    }
 
-            // show ball of whatever
-            putQIO();
+    // show ball of whatever
+    animationShowFrame();
 
-            for (int row = (coord.y - 2); row <= (coord.y + 2); row++) {
-                for (int col = (coord.x - 2); col <= (coord.x + 2); col++) {
-                    spot.y = row;
-                    spot.x = col;
+    for (int i = 0; i < area.length; i++) {
+        if (coordInsidePanel(area.tiles[i])) {
+            dungeonLiteSpot(area.tiles[i]);
+        }
+    }
+    // End explosion.
 
-                    if (coordInBounds(spot) && coordInsidePanel(spot) && coordDistanceBetween(coord, spot) <= max_distance) {
-                        dungeonLiteSpot(spot);
-                    }
-                }
-            }
-            // End explosion.
+    if (total_hits == 1) {
+        printMessageFormatted("The %s envelops a creature!", spell_name);
+    } else if (total_hits > 1) {
+        printMessageFormatted("The %s envelops several creatures!", spell_name);
+    }
 
-            if (total_hits == 1) {
-                printMessage(("The " + spell_name + " envelops a creature!").c_str());
-            } else if (total_hits > 1) {
-                printMessage(("The " + spell_name + " envelops several creatures!").c_str());
-            }
+    if (total_kills == 1) {
+        printMessage("There is a scream of agony!");
+    } else if (total_kills > 1) {
+        printMessage("There are several screams of agony!");
+    }
 
-            if (total_kills == 1) {
-                printMessage("There is a scream of agony!");
-            } else if (total_kills > 1) {
-                printMessage("There are several screams of agony!");
-            }
+    if (total_kills >= 0) {
+        displayCharacterExperience();
+    }
+}
 
-            if (total_kills >= 0) {
-                displayCharacterExperience();
-            }
-            // End ball hitting.
-        } else if (coordInsidePanel(coord) && py.flags.blind < 1) {
-            panelPutTile('*', spellGetColor(spell_type), coord);
+// Shoot a ball in a given direction.  Note that balls have an area affect. -RAK-
+void spellFireBall(Coord_t coord, int direction, int damage_hp, int spell_type, const char *spell_name) {
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
+
+    for (int i = 0; i < path.open; i++) {
+        Coord_t const &spot = path.tiles[i];
 
-            // show bolt
-            putQIO();
+        if (dg.floor[spot.y][spot.x].creature_id > 1) {
+            // The ball hits a monster and explodes.
+            animationPlay();
+            spellFireBallExplodes(spot, damage_hp, spell_type, spell_name);
+            return;
         }
+
+        if (coordInsidePanel(spot) && py.flags.blind < 1) {
+            animationAddStep(spot, '*', spellGetColor(spell_type));
+        }
+    }
+
+    animationPlay();
+
+    // The ball explodes in front of the wall it hits, one which
+    // flew its full distance does not explode.
+    if (path.open < path.length) {
+        spellFireBallExplodes(path.open > 0 ? path.tiles[path.open - 1] : coord, damage_hp, spell_type, spell_name);
     }
 }
 
 // Breath weapon works like a spellFireBall(), but affects the player.
 // Note the area affect. -RAK-
-void spellBreath(Coord_t coord, int monster_id, int damage_hp, int spell_type, const std::string &spell_name) {
+void spellBreath(Coord_t coord, int monster_id, int damage_hp, int spell_type, const char *spell_name) {
     int max_distance = 2;
 
     bool (*destroy)(Inventory_t *);
@@ -1015,109 +1004,108 @@ void spellBreath(Coord_t coord, int monster_id, int damage_hp, int spell_type, c
     uint32_t weapon_type;
     spellGetAreaAffectFlags(spell_type, weapon_type, harm_type, &destroy);
 
-    Coord_t location = Coord_t{0, 0};
+    DungeonArea_t area{};
+    dungeonAreaTiles(coord, max_distance, area);
 
-    for (location.y = coord.y - 2; location.y <= coord.y + 2; location.y++) {
-        for (location.x = coord.x - 2; location.x <= coord.x + 2; location.x++) {
-            if (coordInBounds(location) && coordDistanceBetween(coord, location) <= max_distance && los(coord, location)) {
-                Tile_t const &tile = dg.floor[location.y][location.x];
+    for (int i = 0; i < area.length; i++) {
+        if (!dungeonAreaTileInSight(area, i)) {
+            continue;
+        }
 
-                if (tile.treasure_id != 0 && (*destroy)(&game.treasure.list[tile.treasure_id])) {
-                    (void) dungeonDeleteObject(location);
-                }
+        Coord_t const &location = area.tiles[i];
+        Tile_t const &tile = dg.floor[location.y][location.x];
 
-                if (tile.feature_id <= MAX_OPEN_SPACE) {
-                    // must test status bit, not py.flags.blind here, flag could have
-                    // been set by a previous monster, but the breath should still
-                    // be visible until the blindness takes effect
-                    if (coordInsidePanel(location) && ((py.flags.status & config::player::status::PY_BLIND) == 0u)) {
-                        panelPutTile('*', spellGetColor(spell_type), location);
-                    }
+        if (tile.treasure_id != 0 && (*destroy)(&game.treasure.list[tile.treasure_id])) {
+            (void) dungeonDeleteObject(location);
+        }
 
-                    if (tile.creature_id > 1) {
-                        Monster_t &monster = monsters[tile.creature_id];
-                        Creature_t const &creature = creatures_list[monster.creature_id];
+        if (tile.feature_id <= MAX_OPEN_SPACE) {
+            // must test status bit, not py.flags.blind here, flag could have
+            // been set by a previous monster, but the breath should still
+            // be visible until the blindness takes effect
+            if (coordInsidePanel(location) && ((py.flags.status & config::player::status::PY_BLIND) == 0u)) {
+                panelPutTile('*', spellGetColor(spell_type), location);
+            }
 
-                        int damage = damage_hp;
+            if (tile.creature_id > 1) {
+                Monster_t &monster = monsters[tile.creature_id];
+                Creature_t const &creature = creatures_list[monster.creature_id];
 
-                        if ((harm_type & creature.defenses) != 0) {
-                            damage = damage * 2;
-                        } else if ((weapon_type & creature.spells) != 0u) {
-                            damage = (damage / 4);
-                        }
+                int damage = damage_hp;
 
-                        damage = (damage / (coordDistanceBetween(location, coord) + 1));
-
-                        // can not call monsterTakeHit here, since player does not
-                        // get experience for kill
-                        monster.hp = (int16_t)(monster.hp - damage);
-                        monster.sleep_count = 0;
-
-                        if (monster.hp < 0) {
-                            uint32_t treasure_id = monsterDeath(Coord_t{monster.pos.y, monster.pos.x}, creature.movement);
-
-                            if (monster.lit) {
-                                auto tmp = (uint32_t)((creature_recall[monster.creature_id].movement & config::monsters::move::CM_TREASURE) >> config::monsters::move::CM_TR_SHIFT);
-                                if (tmp > ((treasure_id & config::monsters::move::CM_TREASURE) >> config::monsters::move::CM_TR_SHIFT)) {
-                                    treasure_id = (uint32_t)((treasure_id & ~config::monsters::move::CM_TREASURE) | (tmp << config::monsters::move::CM_TR_SHIFT));
-                                }
-                                creature_recall[monster.creature_id].movement =
-                                    (uint32_t)(treasure_id | (creature_recall[monster.creature_id].movement & ~config::monsters::move::CM_TREASURE));
-                            }
-
-                            // It ate an already processed monster. Handle normally.
-                            if (monster_id < tile.creature_id) {
-                                dungeonDeleteMonster((int) tile.creature_id);
-                            } else {
-                                // If it eats this monster, an already processed monster
-                                // will take its place, causing all kinds of havoc.
-                                // Delay the kill a bit.
-                                dungeonRemoveMonsterFromLevel((int) tile.creature_id);
-                            }
-                        }
-                    } else if (tile.creature_id == 1) {
-                        int damage = (damage_hp / (coordDistanceBetween(location, coord) + 1));
+                if ((harm_type & creature.defenses) != 0) {
+                    damage = damage * 2;
+                } else if ((weapon_type & creature.spells) != 0u) {
+                    damage = (damage / 4);
+                }
 
-                        // let's do at least one point of damage
-                        // prevents randomNumber(0) problem with damagePoisonedGas, also
-                        if (damage == 0) {
-                            damage = 1;
-                        }
+                damage = (damage / (coordDistanceBetween(location, coord) + 1));
+
+                // can not call monsterTakeHit here, since player does not
+                // get experience for kill
+                monster.hp = (int16_t)(monster.hp - damage);
+                monster.sleep_count = 0;
 
-                        switch (spell_type) {
-                            case MagicSpellFlags::Lightning:
-                                damageLightningBolt(damage, spell_name.c_str());
-                                break;
-                            case MagicSpellFlags::PoisonGas:
-                                damagePoisonedGas(damage, spell_name.c_str());
-                                break;
-                            case MagicSpellFlags::Acid:
-                                damageAcid(damage, spell_name.c_str());
-                                break;
-                            case MagicSpellFlags::Frost:
-                                damageCold(damage, spell_name.c_str());
-                                break;
-                            case MagicSpellFlags::Fire:
-                                damageFire(damage, spell_name.c_str());
-                                break;
-                            default:
-                                break;
+                if (monster.hp < 0) {
+                    uint32_t treasure_id = monsterDeath(Coord_t{monster.pos.y, monster.pos.x}, creature.movement);
+
+                    if (monster.lit) {
+                        auto tmp = (uint32_t)((creature_recall[monster.creature_id].movement & config::monsters::move::CM_TREASURE) >> config::monsters::move::CM_TR_SHIFT);
+                        if (tmp > ((treasure_id & config::monsters::move::CM_TREASURE) >> config::monsters::move::CM_TR_SHIFT)) {
+                            treasure_id = (uint32_t)((treasure_id & ~config::monsters::move::CM_TREASURE) | (tmp << config::monsters::move::CM_TR_SHIFT));
                         }
+                        creature_recall[monster.creature_id].movement =
+                            (uint32_t)(treasure_id | (creature_recall[monster.creature_id].movement & ~config::monsters::move::CM_TREASURE));
                     }
+
+                    // It ate an already processed monster. Handle normally.
+                    if (monster_id < tile.creature_id) {
+                        dungeonDeleteMonster((int) tile.creature_id);
+                    } else {
+                        // If it eats this monster, an already processed monster
+                        // will take its place, causing all kinds of havoc.
+                        // Delay the kill a bit.
+                        dungeonRemoveMonsterFromLevel((int) tile.creature_id);
+                    }
+                }
+            } else if (tile.creature_id == 1) {
+                int damage = (damage_hp / (coordDistanceBetween(location, coord) + 1));
+
+                // let's do at least one point of damage
+                // prevents randomNumber(0) problem with damagePoisonedGas, also
+                if (damage == 0) {
+                    damage = 1;
+                }
+
+                switch (spell_type) {
+                    case MagicSpellFlags::Lightning:
+                        damageLightningBolt(damage, spell_name);
+                        break;
+                    case MagicSpellFlags::PoisonGas:
+                        damagePoisonedGas(damage, spell_name);
+                        break;
+                    case MagicSpellFlags::Acid:
+                        damageAcid(damage, spell_name);
+                        break;
+                    case MagicSpellFlags::Frost:
+                        damageCold(damage, spell_name);
+                        break;
+                    case MagicSpellFlags::Fire:
+                        damageFire(damage, spell_name);
+                        break;
+                    default:
+                        break;
                 }
             }
         }
     }
 
     // show the ball of gas
-    putQIO();
+    animationShowFrame();
 
-    Coord_t spot = Coord_t{0, 0};
-    for (spot.y = (coord.y - 2); spot.y <= (coord.y + 2); spot.y++) {
-        for (spot.x = (coord.x - 2); spot.x <= (coord.x + 2); spot.x++) {
-            if (coordInBounds(spot) && coordInsidePanel(spot) && coordDistanceBetween(coord, spot) <= max_distance) {
-                dungeonLiteSpot(spot);
-            }
+    for (int i = 0; i < area.length; i++) {
+        if (coordInsidePanel(area.tiles[i])) {
+            dungeonLiteSpot(area.tiles[i]);
         }
     }
 }
@@ -1169,83 +1157,74 @@ bool spellRechargeItem(int number_of_charges) {
     return true;
 }
 
-// Increase or decrease a creatures hit points -RAK-
-bool spellChangeMonsterHitPoints(Coord_t coord, int direction, int damage_hp) {
-    int distance = 0;
-    bool changed = false;
-    bool finished = false;
+// Finds the first monster a bolt going in a direction would hit.
+static bool spellBoltTarget(Coord_t coord, int direction, Coord_t &target) {
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
-
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
+    for (int i = 0; i < path.open; i++) {
+        Coord_t const &spot = path.tiles[i];
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
+        if (dg.floor[spot.y][spot.x].creature_id > 1) {
+            target = spot;
+            return true;
         }
+    }
 
-        if (tile.creature_id > 1) {
-            finished = true;
+    return false;
+}
 
-            Monster_t const &monster = monsters[tile.creature_id];
-            Creature_t const &creature = creatures_list[monster.creature_id];
+// Increase or decrease a creatures hit points -RAK-
+bool spellChangeMonsterHitPoints(Coord_t coord, int direction, int damage_hp) {
+    if (!spellBoltTarget(coord, direction, coord)) {
+        return false;
+    }
 
-            auto name = monsterNameDescription(creature.name, monster.lit);
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-            if (monsterTakeHit((int) tile.creature_id, damage_hp) >= 0) {
-                printMonsterActionText(name, "dies in a fit of agony.");
-                displayCharacterExperience();
-            } else if (damage_hp > 0) {
-                printMonsterActionText(name, "screams in agony.");
-            }
+    Monster_t const &monster = monsters[tile.creature_id];
+    Creature_t const &creature = creatures_list[monster.creature_id];
 
-            changed = true;
-        }
+    vtype_t name = {'\0'};
+    monsterNameDescription(name, creature.name, monster.lit);
+
+    if (monsterTakeHit((int) tile.creature_id, damage_hp) >= 0) {
+        printMonsterActionText(name, "dies in a fit of agony.");
+        displayCharacterExperience();
+    } else if (damage_hp > 0) {
+        printMonsterActionText(name, "screams in agony.");
     }
 
-    return changed;
+    return true;
 }
 
 // Drains life; note it must be living. -RAK-
 bool spellDrainLifeFromMonster(Coord_t coord, int direction) {
-    int distance = 0;
     bool drained = false;
-    bool finished = false;
-
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
-
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
-        }
-
-        if (tile.creature_id > 1) {
-            finished = true;
+    if (!spellBoltTarget(coord, direction, coord)) {
+        return false;
+    }
 
-            Monster_t const &monster = monsters[tile.creature_id];
-            Creature_t const &creature = creatures_list[monster.creature_id];
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-            if ((creature.defenses & config::monsters::defense::CD_UNDEAD) == 0) {
-                auto name = monsterNameDescription(creature.name, monster.lit);
+    Monster_t const &monster = monsters[tile.creature_id];
+    Creature_t const &creature = creatures_list[monster.creature_id];
 
-                if (monsterTakeHit((int) tile.creature_id, 75) >= 0) {
-                    printMonsterActionText(name, "dies in a fit of agony.");
-                    displayCharacterExperience();
-                } else {
-                    printMonsterActionText(name, "screams in agony.");
-                }
+    if ((creature.defenses & config::monsters::defense::CD_UNDEAD) == 0) {
+        vtype_t name = {'\0'};
+        monsterNameDescription(name, creature.name, monster.lit);
 
-                drained = true;
-            } else {
-                creature_recall[monster.creature_id].defenses |= config::monsters::defense::CD_UNDEAD;
-            }
+        if (monsterTakeHit((int) tile.creature_id, 75) >= 0) {
+            printMonsterActionText(name, "dies in a fit of agony.");
+            displayCharacterExperience();
+        } else {
+            printMonsterActionText(name, "screams in agony.");
         }
+
+        drained = true;
+    } else {
+        creature_recall[monster.creature_id].defenses |= config::monsters::defense::CD_UNDEAD;
     }
 
     return drained;
@@ -1254,49 +1233,38 @@ bool spellDrainLifeFromMonster(Coord_t coord, int direction) {
 // Increase or decrease a creatures speed -RAK-
 // NOTE: cannot slow a winning creature (BALROG)
 bool spellSpeedMonster(Coord_t coord, int direction, int speed) {
-    int distance = 0;
     bool changed = false;
-    bool finished = false;
 
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
-
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
-
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
-        }
+    if (!spellBoltTarget(coord, direction, coord)) {
+        return false;
+    }
 
-        if (tile.creature_id > 1) {
-            finished = true;
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-            Monster_t &monster = monsters[tile.creature_id];
-            Creature_t const &creature = creatures_list[monster.creature_id];
+    Monster_t &monster = monsters[tile.creature_id];
+    Creature_t const &creature = creatures_list[monster.creature_id];
 
-            auto name = monsterNameDescription(creature.name, monster.lit);
+    vtype_t name = {'\0'};
+    monsterNameDescription(name, creature.name, monster.lit);
 
-            if (speed > 0) {
-                monster.speed += speed;
-                monster.sleep_count = 0;
+    if (speed > 0) {
+        monster.speed += speed;
+        monster.sleep_count = 0;
 
-                changed = true;
+        changed = true;
 
-                printMonsterActionText(name, "starts moving faster.");
-            } else if (randomNumber(MON_MAX_LEVELS) > creature.level) {
-                monster.speed += speed;
-                monster.sleep_count = 0;
+        printMonsterActionText(name, "starts moving faster.");
+    } else if (randomNumber(MON_MAX_LEVELS) > creature.level) {
+        monster.speed += speed;
+        monster.sleep_count = 0;
 
-                changed = true;
+        changed = true;
 
-                printMonsterActionText(name, "starts moving slower.");
-            } else {
-                monster.sleep_count = 0;
+        printMonsterActionText(name, "starts moving slower.");
+    } else {
+        monster.sleep_count = 0;
 
-                printMonsterActionText(name, "is unaffected.");
-            }
-        }
+        printMonsterActionText(name, "is unaffected.");
     }
 
     return changed;
@@ -1304,54 +1272,43 @@ bool spellSpeedMonster(Coord_t coord, int direction, int speed) {
 
 // Confuse a creature -RAK-
 bool spellConfuseMonster(Coord_t coord, int direction) {
-    int distance = 0;
     bool confused = false;
-    bool finished = false;
-
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
 
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
+    if (!spellBoltTarget(coord, direction, coord)) {
+        return false;
+    }
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
-        }
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-        if (tile.creature_id > 1) {
-            finished = true;
-
-            Monster_t &monster = monsters[tile.creature_id];
-            Creature_t const &creature = creatures_list[monster.creature_id];
+    Monster_t &monster = monsters[tile.creature_id];
+    Creature_t const &creature = creatures_list[monster.creature_id];
 
-            auto name = monsterNameDescription(creature.name, monster.lit);
+    vtype_t name = {'\0'};
+    monsterNameDescription(name, creature.name, monster.lit);
 
-            if (randomNumber(MON_MAX_LEVELS) < creature.level || ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
-                if (monster.lit && ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
-                    creature_recall[monster.creature_id].defenses |= config::monsters::defense::CD_NO_SLEEP;
-                }
+    if (randomNumber(MON_MAX_LEVELS) < creature.level || ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
+        if (monster.lit && ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
+            creature_recall[monster.creature_id].defenses |= config::monsters::defense::CD_NO_SLEEP;
+        }
 
-                // Monsters which resisted the attack should wake up.
-                // Monsters with innate resistance ignore the attack.
-                if ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) == 0) {
-                    monster.sleep_count = 0;
-                }
+        // Monsters which resisted the attack should wake up.
+        // Monsters with innate resistance ignore the attack.
+        if ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) == 0) {
+            monster.sleep_count = 0;
+        }
 
-                printMonsterActionText(name, "is unaffected.");
-            } else {
-                if (monster.confused_amount != 0u) {
-                    monster.confused_amount += 3;
-                } else {
-                    monster.confused_amount = (uint8_t)(2 + randomNumber(16));
-                }
-                monster.sleep_count = 0;
+        printMonsterActionText(name, "is unaffected.");
+    } else {
+        if (monster.confused_amount != 0u) {
+            monster.confused_amount += 3;
+        } else {
+            monster.confused_amount = (uint8_t)(2 + randomNumber(16));
+        }
+        monster.sleep_count = 0;
 
-                confused = true;
+        confused = true;
 
-                printMonsterActionText(name, "appears confused.");
-            }
-        }
+        printMonsterActionText(name, "appears confused.");
     }
 
     return confused;
@@ -1359,43 +1316,32 @@ bool spellConfuseMonster(Coord_t coord, int direction) {
 
 // Sleep a creature. -RAK-
 bool spellSleepMonster(Coord_t coord, int direction) {
-    int distance = 0;
     bool asleep = false;
-    bool finished = false;
-
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
 
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
-
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
-        }
+    if (!spellBoltTarget(coord, direction, coord)) {
+        return false;
+    }
 
-        if (tile.creature_id > 1) {
-            finished = true;
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-            Monster_t &monster = monsters[tile.creature_id];
-            Creature_t const &creature = creatures_list[monster.creature_id];
+    Monster_t &monster = monsters[tile.creature_id];
+    Creature_t const &creature = creatures_list[monster.creature_id];
 
-            auto name = monsterNameDescription(creature.name, monster.lit);
+    vtype_t name = {'\0'};
+    monsterNameDescription(name, creature.name, monster.lit);
 
-            if (randomNumber(MON_MAX_LEVELS) < creature.level || ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
-                if (monster.lit && ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
-                    creature_recall[monster.creature_id].defenses |= config::monsters::defense::CD_NO_SLEEP;
-                }
+    if (randomNumber(MON_MAX_LEVELS) < creature.level || ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
+        if (monster.lit && ((creature.defenses & config::monsters::defense::CD_NO_SLEEP) != 0)) {
+            creature_recall[monster.creature_id].defenses |= config::monsters::defense::CD_NO_SLEEP;
+        }
 
-                printMonsterActionText(name, "is unaffected.");
-            } else {
-                monster.sleep_count = 500;
+        printMonsterActionText(name, "is unaffected.");
+    } else {
+        monster.sleep_count = 500;
 
-                asleep = true;
+        asleep = true;
 
-                printMonsterActionText(name, "falls asleep.");
-            }
-        }
+        printMonsterActionText(name, "falls asleep.");
     }
 
     return asleep;
@@ -1403,20 +1349,17 @@ bool spellSleepMonster(Coord_t coord, int direction) {
 
 // Turn stone to mud, delete wall. -RAK-
 bool spellWallToMud(Coord_t coord, int direction) {
-    int distance = 0;
     bool turned = false;
     bool finished = false;
 
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
+    // note, this ray can move through walls as it turns them to mud
+    for (int i = 0; i < path.length && !finished; i++) {
+        coord = path.tiles[i];
 
-        // note, this ray can move through walls as it turns them to mud
-        if (distance == config::treasure::OBJECT_BOLTS_MAX_RANGE) {
-            finished = true;
-        }
+        Tile_t const &tile = dg.floor[coord.y][coord.x];
 
         if (tile.feature_id >= MIN_CAVE_WALL && tile.feature_id != TILE_BOUNDARY_WALL) {
             finished = true;
@@ -1460,7 +1403,8 @@ bool spellWallToMud(Coord_t coord, int direction) {
             Creature_t const &creature = creatures_list[monster.creature_id];
 
             if ((creature.defenses & config::monsters::defense::CD_STONE) != 0) {
-                auto name = monsterNameDescription(creature.name, monster.lit);
+                vtype_t name = {'\0'};
+                monsterNameDescription(name, creature.name, monster.lit);
 
                 // Should get these messages even if the monster is not visible.
                 int creature_id = monsterTakeHit((int) tile.creature_id, 100);
@@ -1521,20 +1465,16 @@ bool spellDestroyDoorsTrapsInDirection(Coord_t coord, int direction) {
 // Polymorph a monster -RAK-
 // NOTE: cannot polymorph a winning creature (BALROG)
 bool spellPolymorphMonster(Coord_t coord, int direction) {
-    int distance = 0;
     bool morphed = false;
     bool finished = false;
 
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
+    for (int i = 0; i < path.open && !finished; i++) {
+        coord = path.tiles[i];
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
-        }
+        Tile_t const &tile = dg.floor[coord.y][coord.x];
 
         if (tile.creature_id > 1) {
             Monster_t const &monster = monsters[tile.creature_id];
@@ -1553,7 +1493,8 @@ bool spellPolymorphMonster(Coord_t coord, int direction) {
                     morphed = true;
                 }
             } else {
-                auto name = monsterNameDescription(creature.name, monster.lit);
+                vtype_t name = {'\0'};
+                monsterNameDescription(name, creature.name, monster.lit);
                 printMonsterActionText(name, "is unaffected.");
             }
         }
@@ -1564,20 +1505,16 @@ bool spellPolymorphMonster(Coord_t coord, int direction) {
 
 // Create a wall. -RAK-
 bool spellBuildWall(Coord_t coord, int direction) {
-    int distance = 0;
     bool built = false;
     bool finished = false;
 
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-        Tile_t &tile = dg.floor[coord.y][coord.x];
+    for (int i = 0; i < path.open && !finished; i++) {
+        coord = path.tiles[i];
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue; // we're done here, break out of the loop
-        }
+        Tile_t &tile = dg.floor[coord.y][coord.x];
 
         if (tile.treasure_id != 0) {
             (void) dungeonDeleteObject(coord);
@@ -1586,6 +1523,8 @@ bool spellBuildWall(Coord_t coord, int direction) {
         if (tile.creature_id > 1) {
             finished = true;
 
+            monsterScheduleWake(tile.creature_id);
+
             Monster_t &monster = monsters[tile.creature_id];
             Creature_t const &creature = creatures_list[monster.creature_id];
 
@@ -1599,7 +1538,8 @@ bool spellBuildWall(Coord_t coord, int direction) {
                     damage = diceRoll(Dice_t{4, 8});
                 }
 
-                auto name = monsterNameDescription(creature.name, monster.lit);
+                vtype_t name = {'\0'};
+                monsterNameDescription(name, creature.name, monster.lit);
 
                 printMonsterActionText(name, "wails out in pain!");
 
@@ -1629,32 +1569,24 @@ bool spellBuildWall(Coord_t coord, int direction) {
 
 // Replicate a creature -RAK-
 bool spellCloneMonster(Coord_t coord, int direction) {
-    int distance = 0;
-    bool finished = false;
-
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
+    if (!spellBoltTarget(coord, direction, coord)) {
+        return false;
+    }
 
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
+    Tile_t const &tile = dg.floor[coord.y][coord.x];
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-        } else if (tile.creature_id > 1) {
-            monsters[tile.creature_id].sleep_count = 0;
+    monsters[tile.creature_id].sleep_count = 0;
 
-            // monptr of 0 is safe here, since can't reach here from creatures
-            return monsterMultiply(coord, (int) monsters[tile.creature_id].creature_id, 0);
-        }
-    }
-
-    return false;
+    // monptr of 0 is safe here, since can't reach here from creatures
+    return monsterMultiply(coord, (int) monsters[tile.creature_id].creature_id, 0);
 }
 
 // Move the creature record to a new location -RAK-
 void spellTeleportAwayMonster(int monster_id, int distance_from_player) {
     int counter = 0;
 
+    monsterScheduleWake(monster_id);
+
     Coord_t coord = Coord_t{0, 0};
     Monster_t &monster = monsters[monster_id];
 
@@ -1725,20 +1657,13 @@ void spellTeleportPlayerTo(Coord_t coord) {
 
 // Teleport all creatures in a given direction away -RAK-
 bool spellTeleportAwayMonsterInDirection(Coord_t coord, int direction) {
-    int distance = 0;
     bool teleported = false;
-    bool finished = false;
-
-    while (!finished) {
-        (void) playerMovePosition(direction, coord);
-        distance++;
 
-        Tile_t const &tile = dg.floor[coord.y][coord.x];
+    DungeonPath_t path{};
+    dungeonTracePath(coord, direction, path);
 
-        if (distance > config::treasure::OBJECT_BOLTS_MAX_RANGE || tile.feature_id >= MIN_CLOSED_SPACE) {
-            finished = true;
-            continue;
-        }
+    for (int i = 0; i < path.open; i++) {
+        Tile_t const &tile = dg.floor[path.tiles[i].y][path.tiles[i].x];
 
         if (tile.creature_id > 1) {
             // wake it up
@@ -1794,7 +1719,7 @@ bool spellGenocide() {
                 // genocide is a powerful spell, so we will let the player
                 // know the names of the creatures they did not destroy,
                 // this message makes no sense otherwise
-                printMessage(("The " + std::string(creature.name) + " is unaffected.").c_str());
+                printMessageFormatted("The %s is unaffected.", creature.name);
             }
         }
     }
@@ -1811,9 +1736,10 @@ bool spellSpeedAllMonsters(int speed) {
         Monster_t &monster = monsters[id];
         Creature_t const &creature = creatures_list[monster.creature_id];
 
-        auto name = monsterNameDescription(creature.name, monster.lit);
+        vtype_t name = {'\0'};
+        monsterNameDescription(name, creature.name, monster.lit);
 
-        if (monster.distance_from_player > config::monsters::MON_MAX_SIGHT || !los(py.pos, monster.pos)) {
+        if (monster.distance_from_player > config::monsters::MON_MAX_SIGHT || !los(py.pos, Coord_t{monster.pos.y, monster.pos.x})) {
             continue; // do nothing
         }
 
@@ -1850,9 +1776,10 @@ bool spellSleepAllMonsters() {
         Monster_t &monster = monsters[id];
         Creature_t const &creature = creatures_list[monster.creature_id];
 
-        auto name = monsterNameDescription(creature.name, monster.lit);
+        vtype_t name = {'\0'};
+        monsterNameDescription(name, creature.name, monster.lit);
 
-        if (monster.distance_from_player > config::monsters::MON_MAX_SIGHT || !los(py.pos, monster.pos)) {
+        if (monster.distance_from_player > config::monsters::MON_MAX_SIGHT || !los(py.pos, Coord_t{monster.pos.y, monster.pos.x})) {
             continue; // do nothing
         }
 
@@ -1909,6 +1836,7 @@ bool spellDetectEvil() {
         Monster_t &monster = monsters[id];
 
         if (coordInsidePanel(Coord_t{monster.pos.y, monster.pos.x}) && ((creatures_list[monster.creature_id].defenses & config::monsters::defense::CD_EVIL) != 0)) {
+            monsterScheduleWake(id);
             monster.lit = true;
 
             detected = true;
@@ -1978,7 +1906,8 @@ static void earthquakeHitsMonster(int monster_id) {
             damage = diceRoll(Dice_t{4, 8});
         }
 
-        auto name = monsterNameDescription(creature.name, monster.lit);
+        vtype_t name = {'\0'};
+        monsterNameDescription(name, creature.name, monster.lit);
 
         printMonsterActionText(name, "wails out in pain!");
 
@@ -2064,14 +1993,15 @@ bool spellDispelCreature(int creature_defense, int damage) {
         Monster_t const &monster = monsters[id];
 
         if (monster.distance_from_player <= config::monsters::MON_MAX_SIGHT && ((creature_defense & creatures_list[monster.creature_id].defenses) != 0) &&
-            los(py.pos, monster.pos)) {
+            los(py.pos, Coord_t{monster.pos.y, monster.pos.x})) {
             Creature_t const &creature = creatures_list[monster.creature_id];
 
             creature_recall[monster.creature_id].defenses |= creature_defense;
 
             dispelled = true;
 
-            auto name = monsterNameDescription(creature.name, monster.lit);
+            vtype_t name = {'\0'};
+            monsterNameDescription(name, creature.name, monster.lit);
 
             int hit = monsterTakeHit(id, randomNumber(damage));
 
@@ -2099,8 +2029,9 @@ bool spellTurnUndead() {
         Monster_t &monster = monsters[id];
         Creature_t const &creature = creatures_list[monster.creature_id];
 
-        if (monster.distance_from_player <= config::monsters::MON_MAX_SIGHT && ((creature.defenses & config::monsters::defense::CD_UNDEAD) != 0) && los(py.pos, monster.pos)) {
-            auto name = monsterNameDescription(creature.name, monster.lit);
+        if (monster.distance_from_player <= config::monsters::MON_MAX_SIGHT && ((creature.defenses & config::monsters::defense::CD_UNDEAD) != 0) && los(py.pos, Coord_t{monster.pos.y, monster.pos.x})) {
+            vtype_t name = {'\0'};
+            monsterNameDescription(name, creature.name, monster.lit);
 
             if (py.misc.level + 1 > creature.level || randomNumber(5) == 1) {
                 if (monster.lit) {
@@ -2125,7 +2056,7 @@ bool spellTurnUndead() {
 void spellWardingGlyph() {
     if (dg.floor[py.pos.y][py.pos.x].treasure_id == 0) {
         int free_id = popt();
-        dg.floor[py.pos.y][py.pos.x].treasure_id = (uint8_t) free_id;
+        treasurePlaceOnTile(py.pos, free_id);
         inventoryItemCopyTo(config::dungeon::objects::OBJ_SCARE_MON, game.treasure.list[free_id]);
     }
 }
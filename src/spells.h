@@ -49,9 +49,9 @@ void spellLightLine(Coord_t coord, int direction);
 void spellStarlite(Coord_t coord);
 bool spellDisarmAllInDirection(Coord_t coord, int direction);
 int spellGetColor(int spell_type);
-void spellFireBolt(Coord_t coord, int direction, int damage_hp, int spell_type, const std::string &spell_name);
-void spellFireBall(Coord_t coord, int direction, int damage_hp, int spell_type, const std::string &spell_name);
-void spellBreath(Coord_t coord, int monster_id, int damage_hp, int spell_type, const std::string &spell_name);
+void spellFireBolt(Coord_t coord, int direction, int damage_hp, int spell_type, const char *spell_name);
+void spellFireBall(Coord_t coord, int direction, int damage_hp, int spell_type, const char *spell_name);
+void spellBreath(Coord_t coord, int monster_id, int damage_hp, int spell_type, const char *spell_name);
 bool spellRechargeItem(int number_of_charges);
 bool spellChangeMonsterHitPoints(Coord_t coord, int direction, int damage_hp);
 bool spellDrainLifeFromMonster(Coord_t coord, int direction);
@@ -26,10 +26,12 @@ void storeInitializeOwners() {
         store.unique_items_counter = 0;
         store.good_purchases = 0;
         store.bad_purchases = 0;
+        store.maintenance_due = 0;
 
         for (auto &item : store.inventory) {
             inventoryItemCopyTo(config::dungeon::objects::OBJ_NOTHING, item.item);
             item.cost = 0;
+            item.min_cost = 0;
         }
     }
 }
@@ -86,7 +88,7 @@ static void printSpeechSorry() {
 
 // Displays the set of commands -RAK-
 static void displayStoreCommands() {
-    putStringClearToEOL("You may:", Coord_t{20, 0});
+    putStringClearToEOL("You may:                        P/S) Buy or sell several items.", Coord_t{20, 0});
     putStringClearToEOL(" p) Purchase an item.           b) Browse store's inventory.", Coord_t{21, 0});
     putStringClearToEOL(" s) Sell an item.               i/e/t/w/x) Inventory/Equipment Lists.", Coord_t{22, 0});
     putStringClearToEOL("ESC) Exit from Building.        ^R) Redraw the screen.", Coord_t{23, 0});
@@ -104,6 +106,20 @@ static void displayStoreHaggleCommands(int haggle_type) {
     eraseLine(Coord_t{23, 0}); // clear last line
 }
 
+// The price a store asks for an item, after the player's charisma. This is
+// the final offer when haggling is skipped, otherwise the opening one, both
+// kept with the item since it came into the store.
+static int32_t storeAskingPrice(InventoryRecord_t const &record) {
+    int32_t price = config::options::accept_final_offers ? record.min_cost : -record.cost;
+
+    price = price * playerStatAdjustmentCharisma() / 100;
+    if (price <= 0) {
+        price = 1;
+    }
+
+    return price;
+}
+
 // Displays a store's inventory -RAK-
 static void displayStoreInventory(Store_t &store, int item_pos_start) {
     int item_pos_end = ((item_pos_start / 12) + 1) * 12;
@@ -139,12 +155,7 @@ static void displayStoreInventory(Store_t &store, int item_pos_start) {
         color = Color_Yellow;
 
         if (current_item_count <= 0) {
-            int32_t value = -current_item_count;
-            value = value * playerStatAdjustmentCharisma() / 100;
-            if (value <= 0) {
-                value = 1;
-            }
-            (void) snprintf(msg, 160, "%9d", value);
+            (void) snprintf(msg, 160, "%9d", storeAskingPrice(store.inventory[item_pos_start]));
         } else {
             color = Color_Green;
             (void) snprintf(msg, 160, "%9d [Fixed]", current_item_count);
@@ -175,9 +186,7 @@ static void displaySingleCost(int store_id, int item_id) {
 
     vtype_t msg = {'\0'};
     if (cost < 0) {
-        int32_t c = -cost;
-        c = c * playerStatAdjustmentCharisma() / 100;
-        (void) snprintf(msg, 80, "%d", c);
+        (void) snprintf(msg, 80, "%d", storeAskingPrice(stores[store_id].inventory[item_id]));
     } else {
         color = Color_Green;
         (void) snprintf(msg, 80, "%9d [Fixed]", cost);
@@ -387,6 +396,19 @@ static BidState storeReceiveOffer(int store_id, const char *prompt, int32_t &new
     return status;
 }
 
+// Settles at the store owner's final offer, rather than haggling down to
+// it, if the player agrees to the price.
+static BidState storeAcceptFinalOffer(const char *action, int32_t final_price) {
+    vtype_t msg = {'\0'};
+    (void) snprintf(msg, 80, "%s it for %d gold?", action, final_price);
+
+    if (!getInputConfirmation(msg)) {
+        return BidState::Rejected;
+    }
+
+    return BidState::Received;
+}
+
 static void storePurchaseCustomerAdjustment(int32_t &min_sell, int32_t &max_sell) {
     int charisma = playerStatAdjustmentCharisma();
 
@@ -587,6 +609,31 @@ static void storeSellCustomerAdjustment(Owner_t const &owner, int32_t &cost, int
     }
 }
 
+// The price a store owner offers for an item the player is selling, without
+// haggling: the final offer when the player accepts those, otherwise the
+// opening one. Returns 0 if they will not buy it at all.
+static int32_t storeSellOffer(Store_t const &store, Inventory_t const &item) {
+    int32_t cost = storeItemValue(item);
+    if (cost < 1) {
+        return 0;
+    }
+
+    Owner_t const &owner = store_owners[store.owner_id];
+
+    int32_t min_buy, max_buy, max_sell;
+    storeSellCustomerAdjustment(owner, cost, min_buy, max_buy, max_sell);
+
+    if (max_buy > owner.max_cost) {
+        return owner.max_cost;
+    }
+
+    if (config::options::accept_final_offers) {
+        return std::min(min_buy, (int32_t) owner.max_cost);
+    }
+
+    return std::max(max_buy, 1);
+}
+
 // Haggling routine -RAK-
 static BidState storeSellHaggle(int store_id, int32_t &price, Inventory_t const &item) {
     BidState status = BidState::Received;
@@ -673,9 +720,16 @@ static BidState storeSellHaggle(int store_id, int32_t &price, Inventory_t const
             current_asking_price = 1;
         }
 
+        if (config::options::accept_final_offers) {
+            status = storeAcceptFinalOffer("Sell", final_asking_price);
+            new_price = final_asking_price;
+            accepted_without_haggle = true;
+            rejected = true;
+        }
+
         bool bidding_open;
 
-        do {
+        while (!rejected) {
             do {
                 bidding_open = true;
 
@@ -773,7 +827,7 @@ static BidState storeSellHaggle(int store_id, int32_t &price, Inventory_t const
                     }
                 }
             }
-        } while (!rejected);
+        }
     }
 
     // update bargaining info
@@ -834,6 +888,15 @@ static bool storePurchaseAnItem(int store_id, int &current_top_item_id) {
 
     if (store.inventory[item_id].cost > 0) {
         price = store.inventory[item_id].cost;
+    } else if (config::options::accept_final_offers) {
+        price = storeAskingPrice(store.inventory[item_id]);
+
+        if (py.misc.au < price) {
+            printMessage("You have not the gold to buy it.");
+            status = BidState::Rejected;
+        } else {
+            status = storeAcceptFinalOffer("Buy", price);
+        }
     } else {
         status = storePurchaseHaggle(store_id, price, sell_item);
     }
@@ -1099,6 +1162,260 @@ static bool storeSellAnItem(int store_id, int &current_top_item_id) {
     return kick_customer;
 }
 
+// Asks the player for the items to put in a basket, one press of an item's
+// letter for each of them, showing the running total price. The `add_item`
+// callback adds an item and returns its price, or 0 to turn it down.
+// Returns false if the player gives up, or finishes with an empty basket.
+static bool storeFillBasket(const char *action, int item_pos_start, int item_pos_end, int32_t &total_price, int &total_items,
+                            std::function<int32_t(int)> const &add_item) {
+    total_price = 0;
+    total_items = 0;
+
+    while (true) {
+        vtype_t prompt = {'\0'};
+        (void) snprintf(prompt, 80, "(Items %c-%c, RET to %s, ESC to exit) Add which? [%d for %d gold]", item_pos_start + 'a', item_pos_end + 'a', action, total_items,
+                        total_price);
+
+        char key_char;
+        if (!getMenuItemId(prompt, key_char)) {
+            return false;
+        }
+
+        if (key_char == CTRL_KEY('J') || key_char == CTRL_KEY('M')) {
+            return total_items > 0;
+        }
+
+        int32_t price = 0;
+        if (key_char >= item_pos_start + 'a' && key_char <= item_pos_end + 'a') {
+            price = add_item(key_char - 'a');
+        }
+
+        if (price > 0) {
+            total_price += price;
+            total_items++;
+        } else {
+            terminalBellSound();
+        }
+    }
+}
+
+// Buy several items at once, at their asking prices. The whole basket is
+// checked against the player's gold and pack before anything changes
+// hands, then bought in one go, with one redraw of the store.
+static void storePurchaseSeveralItems(int store_id, int &current_top_item_id) {
+    Store_t &store = stores[store_id];
+
+    if (store.unique_items_counter < 1) {
+        printMessage("I am currently out of stock.");
+        return;
+    }
+
+    uint8_t counts[STORE_MAX_DISCRETE_ITEMS] = {0};
+    int32_t total_price;
+    int total_items;
+    int total_weight = 0;
+
+    auto add_item = [&](int item_id) {
+        item_id += current_top_item_id;
+
+        InventoryRecord_t &record = store.inventory[item_id];
+
+        Inventory_t item{};
+        inventoryTakeOneItem(&item, &record.item);
+
+        if (counts[item_id] + item.items_count > record.item.items_count) {
+            return 0;
+        }
+
+        counts[item_id] = (uint8_t)(counts[item_id] + item.items_count);
+        total_weight += item.items_count * item.weight;
+
+        return record.cost > 0 ? record.cost : storeAskingPrice(record);
+    };
+
+    int item_count = storeItemsToDisplay(store.unique_items_counter, current_top_item_id);
+    if (!storeFillBasket("buy", 0, item_count, total_price, total_items, add_item)) {
+        return;
+    }
+
+    Inventory_t items[STORE_MAX_DISCRETE_ITEMS];
+    int new_slots = 0;
+    int basket_count = 0;
+
+    for (int item_id = 0; item_id < store.unique_items_counter; item_id++) {
+        if (counts[item_id] == 0) {
+            continue;
+        }
+
+        Inventory_t &item = items[basket_count++];
+        item = store.inventory[item_id].item;
+        item.items_count = counts[item_id];
+
+        if (!inventoryItemStacksInPack(item)) {
+            new_slots++;
+        }
+    }
+
+    if (py.misc.au < total_price) {
+        printMessage("You have not the gold for all of that.");
+        return;
+    }
+
+    if (py.pack.unique_items + new_slots > PlayerEquipment::Wield) {
+        printMessage("You cannot carry that many different items.");
+        return;
+    }
+
+    if (py.pack.weight + total_weight > playerCarryingLoadLimit() && !getInputConfirmation("Exceed your weight limit to buy all of that?")) {
+        return;
+    }
+
+    vtype_t msg = {'\0'};
+    (void) snprintf(msg, 80, "Buy %d items for %d gold?", total_items, total_price);
+    if (!getInputConfirmation(msg)) {
+        return;
+    }
+
+    printSpeechFinishedHaggling();
+    storeDecreaseInsults(store_id);
+    py.misc.au -= total_price;
+
+    for (int i = 0; i < basket_count; i++) {
+        (void) inventoryCarryItem(items[i]);
+    }
+
+    storeTakeItems(store_id, counts);
+
+    playerStrength();
+
+    if (current_top_item_id >= store.unique_items_counter) {
+        current_top_item_id = 0;
+    }
+    displayStoreInventory(store, current_top_item_id);
+    displayPlayerRemainingGold();
+}
+
+// Sell several items at once, for the owner's offers without haggling. The
+// store must have room for the whole basket before anything is sold.
+static void storeSellSeveralItems(int store_id, int &current_top_item_id) {
+    Store_t &store = stores[store_id];
+
+    int first_item = py.pack.unique_items;
+    int last_item = -1;
+
+    char mask[PlayerEquipment::Wield];
+
+    for (int counter = 0; counter < py.pack.unique_items; counter++) {
+        mask[counter] = (char) (*store_buy[store_id])(py.inventory[counter].category_id);
+
+        if (mask[counter] != 0) {
+            first_item = std::min(first_item, counter);
+            last_item = std::max(last_item, counter);
+        }
+    }
+
+    if (last_item == -1) {
+        printMessage("You have nothing to sell to this store!");
+        return;
+    }
+
+    uint8_t counts[PlayerEquipment::Wield] = {0};
+    int32_t total_price;
+    int total_items;
+
+    auto add_item = [&](int item_id) {
+        if (mask[item_id] == 0) {
+            return 0;
+        }
+
+        Inventory_t item{};
+        inventoryTakeOneItem(&item, &py.inventory[item_id]);
+
+        int32_t price = storeSellOffer(store, item);
+
+        if (counts[item_id] + item.items_count > py.inventory[item_id].items_count || price < 1) {
+            return 0;
+        }
+
+        counts[item_id] = (uint8_t)(counts[item_id] + item.items_count);
+
+        return price;
+    };
+
+    terminalSaveScreen();
+    (void) displayInventoryItems(first_item, last_item, false, 80, mask);
+
+    bool filled = storeFillBasket("sell", first_item, last_item, total_price, total_items, add_item);
+
+    terminalRestoreScreen();
+
+    if (!filled) {
+        return;
+    }
+
+    Inventory_t items[PlayerEquipment::Wield];
+    int basket_count = 0;
+
+    for (int item_id = last_item; item_id >= first_item; item_id--) {
+        if (counts[item_id] != 0) {
+            items[basket_count] = py.inventory[item_id];
+            items[basket_count].items_count = counts[item_id];
+            basket_count++;
+        }
+    }
+
+    if (!storeCanCarryItems(store_id, items, basket_count)) {
+        printMessage("I have not the room in my store to keep all of that.");
+        return;
+    }
+
+    vtype_t msg = {'\0'};
+    (void) snprintf(msg, 80, "Sell %d items for %d gold?", total_items, total_price);
+    if (!getInputConfirmation(msg)) {
+        return;
+    }
+
+    printSpeechFinishedHaggling();
+    storeDecreaseInsults(store_id);
+    py.misc.au += total_price;
+
+    // from the end of the pack, so that taking items out of it does not
+    // move the ones still to be sold
+    basket_count = 0;
+
+    for (int item_id = last_item; item_id >= first_item; item_id--) {
+        if (counts[item_id] == 0) {
+            continue;
+        }
+
+        // identify object in inventory to set objects_identified array,
+        // which may combine it with a stack before it
+        int pack_id = item_id;
+        itemIdentify(py.inventory[pack_id], pack_id);
+
+        Inventory_t &sold_item = items[basket_count++];
+        inventoryTakeOneItem(&sold_item, &py.inventory[pack_id]);
+
+        // call spellItemIdentifyAndRemoveRandomInscription for store item, so charges/pluses are known
+        spellItemIdentifyAndRemoveRandomInscription(sold_item);
+
+        for (int taken = 0; taken < counts[item_id]; taken += sold_item.items_count) {
+            inventoryDestroyItem(pack_id);
+        }
+        sold_item.items_count = counts[item_id];
+    }
+
+    storeCarryItems(store_id, items, basket_count);
+
+    (void) snprintf(msg, 80, "You've sold %d items.", total_items);
+    printMessage(msg);
+
+    playerStrength();
+
+    displayStoreInventory(store, current_top_item_id);
+    displayPlayerRemainingGold();
+}
+
 // Entering a store -RAK-
 void storeEnter(int store_id) {
     Store_t const &store = stores[store_id];
@@ -1108,6 +1425,8 @@ void storeEnter(int store_id) {
         return;
     }
 
+    storeMaintenanceCatchUp(store_id);
+
     int current_top_item_id = 0;
     displayStore(stores[store_id], store_owners[store.owner_id].name, current_top_item_id);
 
@@ -1166,6 +1485,14 @@ void storeEnter(int store_id) {
                 case 's':
                     exit_store = storeSellAnItem(store_id, current_top_item_id);
                     break;
+                case 'P':
+                    storePurchaseSeveralItems(store_id, current_top_item_id);
+                    displayStoreCommands();
+                    break;
+                case 'S':
+                    storeSellSeveralItems(store_id, current_top_item_id);
+                    displayStoreCommands();
+                    break;
                 default:
                     terminalBellSound();
                     break;
@@ -13,7 +13,8 @@ constexpr uint8_t COST_ADJUSTMENT = 100;         // Adjust prices for buying and
 
 // InventoryRecord_t data for a store inventory item
 typedef struct {
-    int32_t cost;
+    int32_t cost;     // Fixed price if positive, else minus the asking price
+    int32_t min_cost; // Lowest asking price, the final offer when haggling
     Inventory_t item;
 } InventoryRecord_t;
 
@@ -25,6 +26,7 @@ typedef struct {
     uint8_t unique_items_counter;
     uint16_t good_purchases;
     uint16_t bad_purchases;
+    uint16_t maintenance_due; // Turn overs of stock missed, not saved
     InventoryRecord_t inventory[STORE_MAX_DISCRETE_ITEMS];
 } Store_t;
 
@@ -61,8 +63,12 @@ void storeEnter(int store_id);
 
 // store_inventory
 void storeMaintenance();
+void storeMaintenanceCatchUp(int store_id);
 int32_t storeItemValue(Inventory_t const &item);
 int32_t storeItemSellPrice(Store_t const &store, int32_t &min_price, int32_t &max_price, Inventory_t const &item);
 bool storeCheckPlayerItemsCount(Store_t const &store, Inventory_t const &item);
 void storeCarryItem(int store_id, int &index_id, Inventory_t &item);
 void storeDestroyItem(int store_id, int item_id, bool only_one_of);
+void storeTakeItems(int store_id, uint8_t const *counts);
+bool storeCanCarryItems(int store_id, Inventory_t const *items, int count);
+void storeCarryItems(int store_id, Inventory_t const *items, int count);
@@ -7,10 +7,20 @@
 
 #include "headers.h"
 
+#include <algorithm>
+
 Store_t stores[MAX_STORES];
 
-static void storeItemInsert(int store_id, int pos, int32_t i_cost, Inventory_t *item);
-static void storeItemCreate(int store_id, int16_t max_cost);
+// Stock made for a store in one turn over, kept in the order it was made
+// until all of it is merged into the store's inventory at once.
+typedef struct {
+    InventoryRecord_t records[STORE_MAX_DISCRETE_ITEMS];
+    int count;
+} StoreRestock_t;
+
+static void storeItemInsert(int store_id, int pos, int32_t i_cost, int32_t min_cost, Inventory_t *item);
+static void storeItemCreate(int store_id, int16_t max_cost, StoreRestock_t &restock);
+static void storeRestockMerge(Store_t &store, StoreRestock_t &restock);
 
 static int32_t getWeaponArmorBuyPrice(Inventory_t const &item);
 static int32_t getAmmoBuyPrice(Inventory_t const &item);
@@ -20,38 +30,64 @@ static int32_t getRingAmuletBuyPrice(Inventory_t const &item);
 static int32_t getWandStaffBuyPrice(Inventory_t const &item);
 static int32_t getPickShovelBuyPrice(Inventory_t const &item);
 
-// Initialize and up-keep the store's inventory. -RAK-
-void storeMaintenance() {
-    for (int store_id = 0; store_id < MAX_STORES; store_id++) {
-        Store_t &store = stores[store_id];
-
-        store.insults_counter = 0;
-        if (store.unique_items_counter >= config::stores::STORE_MIN_AUTO_SELL_ITEMS) {
-            int turnaround = randomNumber(config::stores::STORE_STOCK_TURN_AROUND);
-            if (store.unique_items_counter >= config::stores::STORE_MAX_AUTO_BUY_ITEMS) {
-                turnaround += 1 + store.unique_items_counter - config::stores::STORE_MAX_AUTO_BUY_ITEMS;
-            }
+// Turns over a store's stock once: sells some of it off, then makes new. -RAK-
+static void storeTurnOverStock(int store_id) {
+    Store_t &store = stores[store_id];
+
+    store.insults_counter = 0;
+    if (store.unique_items_counter >= config::stores::STORE_MIN_AUTO_SELL_ITEMS) {
+        int turnaround = randomNumber(config::stores::STORE_STOCK_TURN_AROUND);
+        if (store.unique_items_counter >= config::stores::STORE_MAX_AUTO_BUY_ITEMS) {
+            turnaround += 1 + store.unique_items_counter - config::stores::STORE_MAX_AUTO_BUY_ITEMS;
+        }
+        turnaround--;
+        while (turnaround >= 0) {
+            storeDestroyItem(store_id, randomNumber(store.unique_items_counter) - 1, false);
             turnaround--;
-            while (turnaround >= 0) {
-                storeDestroyItem(store_id, randomNumber(store.unique_items_counter) - 1, false);
-                turnaround--;
-            }
+        }
+    }
+
+    if (store.unique_items_counter <= config::stores::STORE_MAX_AUTO_BUY_ITEMS) {
+        int turnaround = randomNumber(config::stores::STORE_STOCK_TURN_AROUND);
+        if (store.unique_items_counter < config::stores::STORE_MIN_AUTO_SELL_ITEMS) {
+            turnaround += config::stores::STORE_MIN_AUTO_SELL_ITEMS - store.unique_items_counter;
         }
 
-        if (store.unique_items_counter <= config::stores::STORE_MAX_AUTO_BUY_ITEMS) {
-            int turnaround = randomNumber(config::stores::STORE_STOCK_TURN_AROUND);
-            if (store.unique_items_counter < config::stores::STORE_MIN_AUTO_SELL_ITEMS) {
-                turnaround += config::stores::STORE_MIN_AUTO_SELL_ITEMS - store.unique_items_counter;
-            }
+        int16_t max_cost = store_owners[store.owner_id].max_cost;
 
-            int16_t max_cost = store_owners[store.owner_id].max_cost;
+        StoreRestock_t restock;
+        restock.count = 0;
 
+        turnaround--;
+        while (turnaround >= 0) {
+            storeItemCreate(store_id, max_cost, restock);
             turnaround--;
-            while (turnaround >= 0) {
-                storeItemCreate(store_id, max_cost);
-                turnaround--;
-            }
         }
+
+        storeRestockMerge(store, restock);
+    }
+}
+
+// Marks every store as due a turn over of its stock. This is only done
+// once the player next enters the store, see storeMaintenanceCatchUp().
+void storeMaintenance() {
+    for (auto &store : stores) {
+        if (store.maintenance_due < UINT16_MAX) {
+            store.maintenance_due++;
+        }
+    }
+}
+
+// Turns over a store's stock for every maintenance missed since the
+// player was last in it.
+void storeMaintenanceCatchUp(int store_id) {
+    PROFILE_SCOPE(StoreMaintenance);
+
+    Store_t &store = stores[store_id];
+
+    while (store.maintenance_due > 0) {
+        storeTurnOverStock(store_id);
+        store.maintenance_due--;
     }
 }
 
@@ -218,6 +254,15 @@ int32_t storeItemSellPrice(Store_t const &store, int32_t &min_price, int32_t &ma
     return price;
 }
 
+// Whether an item would fit on the stack in a store slot without its
+// number overflowing.
+static bool storeItemHasRoomFor(Inventory_t const &store_item, Inventory_t const &item) {
+    // note: items with sub_category_id of gte ITEM_SINGLE_STACK_MAX only stack
+    // if their `sub_category_id`s match
+    return store_item.category_id == item.category_id && store_item.sub_category_id == item.sub_category_id && (int) (store_item.items_count + item.items_count) < 256 &&
+           (item.sub_category_id < ITEM_GROUP_MIN || store_item.misc_use == item.misc_use);
+}
+
 // Check to see if they will be carrying too many objects -RAK-
 bool storeCheckPlayerItemsCount(Store_t const &store, Inventory_t const &item) {
     if (store.unique_items_counter < STORE_MAX_DISCRETE_ITEMS) {
@@ -231,12 +276,7 @@ bool storeCheckPlayerItemsCount(Store_t const &store, Inventory_t const &item) {
     bool store_check = false;
 
     for (int i = 0; i < store.unique_items_counter; i++) {
-        Inventory_t const &store_item = store.inventory[i].item;
-
-        // note: items with sub_category_id of gte ITEM_SINGLE_STACK_MAX only stack
-        // if their `sub_category_id`s match
-        if (store_item.category_id == item.category_id && store_item.sub_category_id == item.sub_category_id && (int) (store_item.items_count + item.items_count) < 256 &&
-            (item.sub_category_id < ITEM_GROUP_MIN || store_item.misc_use == item.misc_use)) {
+        if (storeItemHasRoomFor(store.inventory[i].item, item)) {
             store_check = true;
         }
     }
@@ -245,7 +285,7 @@ bool storeCheckPlayerItemsCount(Store_t const &store, Inventory_t const &item) {
 }
 
 // Insert INVEN_MAX at given location
-static void storeItemInsert(int store_id, int pos, int32_t i_cost, Inventory_t *item) {
+static void storeItemInsert(int store_id, int pos, int32_t i_cost, int32_t min_cost, Inventory_t *item) {
     Store_t &store = stores[store_id];
 
     for (int i = store.unique_items_counter - 1; i >= pos; i--) {
@@ -254,50 +294,57 @@ static void storeItemInsert(int store_id, int pos, int32_t i_cost, Inventory_t *
 
     store.inventory[pos].item = *item;
     store.inventory[pos].cost = -i_cost;
+    store.inventory[pos].min_cost = min_cost;
     store.unique_items_counter++;
 }
 
+static bool storeItemStacksWith(Inventory_t const &store_item, Inventory_t const &item) {
+    return store_item.category_id == item.category_id && store_item.sub_category_id == item.sub_category_id && item.sub_category_id >= ITEM_SINGLE_STACK_MIN &&
+           (item.sub_category_id < ITEM_GROUP_MIN || store_item.misc_use == item.misc_use);
+}
+
+// Adds an item to the stack in a store slot, `item_cost` being its asking price.
+static void storeStackItem(Store_t const &store, InventoryRecord_t &record, Inventory_t const &item, int32_t item_cost) {
+    record.item.items_count += item.items_count;
+
+    // must set new cost for group items, do this only for items
+    // strictly greater than group_min, not for torches, this
+    // must be recalculated for entire group
+    if (item.sub_category_id > ITEM_GROUP_MIN) {
+        (void) storeItemSellPrice(store, record.min_cost, item_cost, record.item);
+        record.cost = -item_cost;
+    } else if (record.item.items_count > 24) {
+        // must let group objects (except torches) stack over 24
+        // since there may be more than 24 in the group
+        record.item.items_count = 24;
+    }
+}
+
 // Add the item in INVEN_MAX to stores inventory. -RAK-
 void storeCarryItem(int store_id, int &index_id, Inventory_t &item) {
     index_id = -1;
 
     Store_t &store = stores[store_id];
 
-    int32_t item_cost, dummy;
-    if (storeItemSellPrice(store, dummy, item_cost, item) < 1) {
+    int32_t item_cost, min_cost;
+    if (storeItemSellPrice(store, min_cost, item_cost, item) < 1) {
         return;
     }
 
     int item_id = 0;
-    int item_num = item.items_count;
-    int item_category = item.category_id;
-    int item_sub_catagory = item.sub_category_id;
 
     bool flag = false;
     do {
-        Inventory_t &store_item = store.inventory[item_id].item;
+        InventoryRecord_t &record = store.inventory[item_id];
 
-        if (item_category == store_item.category_id) {
-            if (item_sub_catagory == store_item.sub_category_id && // Adds to other item
-                item_sub_catagory >= ITEM_SINGLE_STACK_MIN && (item_sub_catagory < ITEM_GROUP_MIN || store_item.misc_use == item.misc_use)) {
+        if (item.category_id == record.item.category_id) {
+            if (storeItemStacksWith(record.item, item)) { // Adds to other item
                 index_id = item_id;
-                store_item.items_count += item_num;
-
-                // must set new cost for group items, do this only for items
-                // strictly greater than group_min, not for torches, this
-                // must be recalculated for entire group
-                if (item_sub_catagory > ITEM_GROUP_MIN) {
-                    (void) storeItemSellPrice(store, dummy, item_cost, store_item);
-                    store.inventory[item_id].cost = -item_cost;
-                } else if (store_item.items_count > 24) {
-                    // must let group objects (except torches) stack over 24
-                    // since there may be more than 24 in the group
-                    store_item.items_count = 24;
-                }
+                storeStackItem(store, record, item, item_cost);
                 flag = true;
             }
-        } else if (item_category > store_item.category_id) { // Insert into list
-            storeItemInsert(store_id, item_id, item_cost, &item);
+        } else if (item.category_id > record.item.category_id) { // Insert into list
+            storeItemInsert(store_id, item_id, item_cost, min_cost, &item);
             flag = true;
             index_id = item_id;
         }
@@ -306,11 +353,119 @@ void storeCarryItem(int store_id, int &index_id, Inventory_t &item) {
 
     // Becomes last item in list
     if (!flag) {
-        storeItemInsert(store_id, (int) store.unique_items_counter, item_cost, &item);
+        storeItemInsert(store_id, (int) store.unique_items_counter, item_cost, min_cost, &item);
         index_id = store.unique_items_counter - 1;
     }
 }
 
+// The same check as storeCheckPlayerItemsCount(), counting the new stock
+// not yet merged into the store as well.
+static bool storeRestockHasRoom(Store_t const &store, StoreRestock_t const &restock, Inventory_t const &item) {
+    if (store.unique_items_counter + restock.count < STORE_MAX_DISCRETE_ITEMS) {
+        return true;
+    }
+
+    if (!inventoryItemStackable(item)) {
+        return false;
+    }
+
+    auto has_room = [&item](InventoryRecord_t const &record) { return storeItemHasRoomFor(record.item, item); };
+
+    return std::any_of(store.inventory, store.inventory + store.unique_items_counter, has_room) || std::any_of(restock.records, restock.records + restock.count, has_room);
+}
+
+// Adds an item to the new stock as storeCarryItem() would to the store:
+// onto a stack already there, or else into a slot of its own.
+// Returns false if there was no slot left for it.
+static bool storeRestockCarry(Store_t &store, StoreRestock_t &restock, Inventory_t const &item) {
+    int32_t item_cost, min_cost;
+    if (storeItemSellPrice(store, min_cost, item_cost, item) < 1) {
+        return true;
+    }
+
+    // stacks in the store come before any of the same kind in the new stock,
+    // as the new stock goes after the store's items of the same category
+    for (int i = 0; i < store.unique_items_counter; i++) {
+        if (storeItemStacksWith(store.inventory[i].item, item)) {
+            // changing a stack in place moves nothing, so need not wait
+            storeStackItem(store, store.inventory[i], item, item_cost);
+            return true;
+        }
+    }
+
+    for (int i = 0; i < restock.count; i++) {
+        if (storeItemStacksWith(restock.records[i].item, item)) {
+            storeStackItem(store, restock.records[i], item, item_cost);
+            return true;
+        }
+    }
+
+    if (store.unique_items_counter + restock.count >= STORE_MAX_DISCRETE_ITEMS) {
+        return false;
+    }
+
+    restock.records[restock.count].item = item;
+    restock.records[restock.count].cost = -item_cost;
+    restock.records[restock.count].min_cost = min_cost;
+    restock.count++;
+
+    return true;
+}
+
+// Merges the new stock into the store's inventory, which is kept sorted by
+// category, highest first. Each new item goes after those of its category
+// already there, and after those made before it, so the inventory ends up
+// as it would have with each item carried into the store as it was made.
+static void storeRestockMerge(Store_t &store, StoreRestock_t &restock) {
+    auto by_category = [](InventoryRecord_t const &a, InventoryRecord_t const &b) { return a.item.category_id > b.item.category_id; };
+    std::stable_sort(restock.records, restock.records + restock.count, by_category);
+
+    int from_id = store.unique_items_counter - 1;
+    int restock_id = restock.count - 1;
+    int to_id = from_id + restock.count;
+
+    while (restock_id >= 0) {
+        if (from_id >= 0 && store.inventory[from_id].item.category_id < restock.records[restock_id].item.category_id) {
+            store.inventory[to_id--] = store.inventory[from_id--];
+        } else {
+            store.inventory[to_id--] = restock.records[restock_id--];
+        }
+    }
+
+    store.unique_items_counter = (uint8_t)(store.unique_items_counter + restock.count);
+}
+
+// Whether a store has room for all of several items, counting those which
+// go onto stacks it already has, or onto each other.
+bool storeCanCarryItems(int store_id, Inventory_t const *items, int count) {
+    Store_t store = stores[store_id];
+
+    StoreRestock_t restock;
+    restock.count = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (!storeRestockHasRoom(store, restock, items[i]) || !storeRestockCarry(store, restock, items[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Adds several items to a store's inventory, merging them in all at once.
+void storeCarryItems(int store_id, Inventory_t const *items, int count) {
+    Store_t &store = stores[store_id];
+
+    StoreRestock_t restock;
+    restock.count = 0;
+
+    for (int i = 0; i < count; i++) {
+        (void) storeRestockCarry(store, restock, items[i]);
+    }
+
+    storeRestockMerge(store, restock);
+}
+
 // Destroy an item in the stores inventory.  Note that if
 // `only_one_of` is false, an entire slot is destroyed -RAK-
 void storeDestroyItem(int store_id, int item_id, bool only_one_of) {
@@ -340,12 +495,38 @@ void storeDestroyItem(int store_id, int item_id, bool only_one_of) {
         }
         inventoryItemCopyTo(config::dungeon::objects::OBJ_NOTHING, store.inventory[store.unique_items_counter - 1].item);
         store.inventory[store.unique_items_counter - 1].cost = 0;
+        store.inventory[store.unique_items_counter - 1].min_cost = 0;
         store.unique_items_counter--;
     }
 }
 
-// Creates an item and inserts it into store's inven -RAK-
-static void storeItemCreate(int store_id, int16_t max_cost) {
+// Takes `counts[i]` of the item in each slot `i` out of a store, closing up
+// the emptied slots in one pass rather than one at a time.
+void storeTakeItems(int store_id, uint8_t const *counts) {
+    Store_t &store = stores[store_id];
+
+    int to_id = 0;
+
+    for (int from_id = 0; from_id < store.unique_items_counter; from_id++) {
+        InventoryRecord_t &record = store.inventory[from_id];
+
+        if (counts[from_id] < record.item.items_count) {
+            record.item.items_count -= counts[from_id];
+            store.inventory[to_id++] = record;
+        }
+    }
+
+    for (int i = to_id; i < store.unique_items_counter; i++) {
+        inventoryItemCopyTo(config::dungeon::objects::OBJ_NOTHING, store.inventory[i].item);
+        store.inventory[i].cost = 0;
+        store.inventory[i].min_cost = 0;
+    }
+
+    store.unique_items_counter = (uint8_t) to_id;
+}
+
+// Creates an item and adds it to the store's new stock -RAK-
+static void storeItemCreate(int store_id, int16_t max_cost, StoreRestock_t &restock) {
     int free_id = popt();
 
     for (int tries = 0; tries <= 3; tries++) {
@@ -355,15 +536,14 @@ static void storeItemCreate(int store_id, int16_t max_cost) {
 
         Inventory_t &item = game.treasure.list[free_id];
 
-        if (storeCheckPlayerItemsCount(stores[store_id], item)) {
+        if (storeRestockHasRoom(stores[store_id], restock, item)) {
             // Item must be good: cost > 0.
             if (item.cost > 0 && item.cost < max_cost) {
                 // equivalent to calling spellIdentifyItem(),
                 // except will not change the objects_identified array.
                 itemIdentifyAsStoreBought(item);
 
-                int dummy;
-                storeCarryItem(store_id, dummy, item);
+                (void) storeRestockCarry(stores[store_id], restock, item);
 
                 tries = 10;
             }
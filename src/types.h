@@ -7,6 +7,13 @@
 // CNIL is used instead of null to help avoid lint errors.
 constexpr char *CNIL = nullptr;
 
+// Lets the compiler check the arguments given to printf() style functions.
+#if defined(__GNUC__)
+#define MORIA_PRINTF_FORMAT(format_index, first_argument) __attribute__((format(printf, format_index, first_argument)))
+#else
+#define MORIA_PRINTF_FORMAT(format_index, first_argument)
+#endif
+
 // Many of the character fields used to be fixed length, which
 // greatly increased the size of the executable. Many fixed
 // length fields have been replaced with variable length ones.
@@ -22,3 +29,10 @@ typedef struct {
     int y;
     int x;
 } Coord_t;
+
+// A dungeon position in two bytes, for records kept in bulk. This is
+// enough as MAX_HEIGHT and MAX_WIDTH are both less than 256.
+typedef struct {
+    uint8_t y;
+    uint8_t x;
+} PackedCoord_t;
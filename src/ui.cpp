@@ -80,6 +80,8 @@ bool coordInsidePanel(Coord_t coord) {
 
 // Prints the map of the dungeon -RAK-
 void drawDungeonPanel() {
+    PROFILE_SCOPE(DrawDungeonPanel);
+
     int line = 1;
 
     Coord_t coord = Coord_t{0, 0};
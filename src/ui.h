@@ -52,6 +52,7 @@ extern bool panic_save;
 
 // UI - IO
 bool terminalInitialize();
+bool terminalInitializeHeadless();
 void terminalRestore();
 void terminalSaveScreen();
 void terminalRestoreScreen();
@@ -65,14 +66,15 @@ void addChar(char ch, Coord_t coord);
 int setColor(int color);
 void clearColor(int color);
 void putString(const char *out_str, Coord_t coord, int color = -1);
-void putStringClearToEOL(const std::string &str, Coord_t coord, int color = -1);
+void putStringClearToEOL(const char *str, Coord_t coord, int color = -1);
 void eraseLine(Coord_t coord);
 void panelMoveCursor(Coord_t coord);
 void panelPutTile(char ch, int color, Coord_t coord);
-void messageLinePrintMessage(std::string message);
+void messageLinePrintMessage(const char *message);
 void messageLineClear();
 void printMessage(const char *msg);
-void printMessageNoCommandInterrupt(const std::string &msg);
+void printMessageFormatted(const char *format, ...) MORIA_PRINTF_FORMAT(1, 2);
+void printMessageNoCommandInterrupt(const char *msg);
 char getKeyInput();
 bool getCommand(const std::string &prompt, char &command);
 bool getMenuItemId(const std::string &prompt, char &command);
@@ -95,6 +97,17 @@ int topen(const char *file, int flags, int mode);
 bool tilde(const char *file, char *expanded);
 #endif
 
+// UI - Recording
+bool recordingStart(const std::string &filename);
+void recordingStop();
+void recordingCaptureFrame();
+bool recordingPlayback(const std::string &filename);
+
+// UI - Animation
+void animationAddStep(Coord_t coord, char symbol, int color);
+void animationPlay();
+void animationShowFrame();
+
 // UI
 bool coordOutsidePanel(Coord_t coord, bool force);
 bool coordInsidePanel(Coord_t coord);
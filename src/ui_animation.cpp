@@ -0,0 +1,75 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Bolt, ball and thrown object animation
+
+#include "headers.h"
+#include "curses.h"
+
+#include <chrono>
+
+// The game works out where a projectile goes before it is drawn, adding a
+// step for every visible tile it passes through. The steps are then shown
+// one frame at a time, with a single screen refresh each, so the flight
+// takes the same time however fast the terminal is.
+typedef struct {
+    Coord_t coord;
+    char symbol;
+    int color;
+} AnimationStep_t;
+
+static std::vector<AnimationStep_t> animation_steps;
+
+// Nothing is drawn when replaying a key log headlessly, or when the player
+// has turned the animation off.
+static bool animationEnabled() {
+    return config::options::animate_projectiles && config::options::ANIMATION_FRAMES_PER_SECOND > 0 && !replayIsPlaying();
+}
+
+// Waits until one frame period has passed since the frame was started.
+static void animationWaitForFrame(std::chrono::steady_clock::time_point frame_started_at) {
+    auto frame_period = std::chrono::milliseconds(1000 / config::options::ANIMATION_FRAMES_PER_SECOND);
+    auto elapsed = std::chrono::steady_clock::now() - frame_started_at;
+
+    if (elapsed < frame_period) {
+        (void) napms((int) std::chrono::duration_cast<std::chrono::milliseconds>(frame_period - elapsed).count());
+    }
+}
+
+void animationAddStep(Coord_t coord, char symbol, int color) {
+    if (!animationEnabled()) {
+        return;
+    }
+
+    animation_steps.push_back(AnimationStep_t{coord, symbol, color});
+}
+
+// Shows the recorded steps of a projectile, and forgets them. The last
+// step is cleared from the screen, but the caller does the next refresh.
+void animationPlay() {
+    for (auto const &step : animation_steps) {
+        auto frame_started_at = std::chrono::steady_clock::now();
+
+        panelPutTile(step.symbol, step.color, step.coord);
+        putQIO();
+
+        animationWaitForFrame(frame_started_at);
+
+        dungeonLiteSpot(step.coord);
+    }
+
+    animation_steps.clear();
+}
+
+// Shows what has been drawn, an explosion for example, for one frame.
+void animationShowFrame() {
+    auto frame_started_at = std::chrono::steady_clock::now();
+
+    putQIO();
+
+    if (animationEnabled()) {
+        animationWaitForFrame(frame_started_at);
+    }
+}
@@ -10,6 +10,7 @@
 #include "curses.h"
 
 static bool curses_on = false;
+static bool curses_headless = false;
 
 extern Color_t colors[255];
 
@@ -71,6 +72,42 @@ bool terminalInitialize() {
     return true;
 }
 
+// Swap the terminal for one which draws to nowhere, so that
+// a game can be replayed as fast as it can be played.
+bool terminalInitializeHeadless() {
+    FILE *null_output = fopen("/dev/null", "w");
+    if (null_output == nullptr) {
+        return false;
+    }
+
+    // Tools like the monster bench never started the real terminal, and
+    // ending it would write to their output.
+    if (stdscr != nullptr) {
+        (void) delwin(save_screen);
+        (void) endwin();
+    }
+
+    SCREEN *screen = newterm("vt100", null_output, stdin);
+    if (screen == nullptr) {
+        (void) fclose(null_output);
+        return false;
+    }
+
+    (void) set_term(screen);
+
+    config::options::use_colors = false;
+
+    save_screen = newwin(0, 0, 0, 0);
+    if (save_screen == nullptr) {
+        return false;
+    }
+
+    moriaTerminalInitialize();
+    curses_headless = true;
+
+    return true;
+}
+
 // Put the terminal in the original mode. -CJS-
 void terminalRestore() {
     if (!curses_on) {
@@ -79,12 +116,16 @@ void terminalRestore() {
 
     // Dump any remaining buffer
     putQIO();
+    recordingStop();
 
-    // this moves curses to bottom right corner
-    int y = 0;
-    int x = 0;
-    getyx(stdscr, y, x);
-    mvcur(y, x, LINES - 1, 0);
+    // this moves curses to bottom right corner, which mvcur() does on
+    // stdout, whichever terminal is in use
+    if (!curses_headless) {
+        int y = 0;
+        int x = 0;
+        getyx(stdscr, y, x);
+        mvcur(y, x, LINES - 1, 0);
+    }
 
     // exit curses
     endwin();
@@ -119,6 +160,8 @@ void putQIO() {
     screen_has_changed = true;
 
     (void) refresh();
+
+    recordingCaptureFrame();
 }
 
 // Flush the buffer -RAK-
@@ -215,14 +258,14 @@ void putString(const char *out_str, Coord_t coord, int color) {
 }
 
 // Outputs a line to a given y, x position -RAK-
-void putStringClearToEOL(const std::string &str, Coord_t coord, int color) {
+void putStringClearToEOL(const char *str, Coord_t coord, int color) {
     if (coord.y == MSG_LINE && message_ready_to_print) {
         printMessage(CNIL);
     }
 
     (void) move(coord.y, coord.x);
     clrtoeol();
-    putString(str.c_str(), coord, color);
+    putString(str, coord, color);
 }
 
 // Clears given line of text -RAK-
@@ -268,7 +311,7 @@ static Coord_t currentCursorPosition() {
 
 // messageLinePrintMessage will print a line of text to the message line (0,0).
 // first clearing the line of any text!
-void messageLinePrintMessage(std::string message) {
+void messageLinePrintMessage(const char *message) {
     // save current cursor position
     Coord_t coord = currentCursorPosition();
 
@@ -277,9 +320,7 @@ void messageLinePrintMessage(std::string message) {
     clrtoeol();
 
     // truncate message if it's too long!
-    message.resize(79);
-
-    addstr(message.c_str());
+    addnstr(message, 79);
 
     // restore cursor to old position
     move(coord.y, coord.x);
@@ -371,12 +412,25 @@ void printMessage(const char *msg) {
     }
 }
 
+// Formats a message on the stack, for messages built from names and numbers.
+// Like printMessage(), only the first MORIA_MESSAGE_SIZE characters are kept.
+void printMessageFormatted(const char *format, ...) {
+    vtype_t msg = {'\0'};
+
+    va_list args;
+    va_start(args, format);
+    (void) vsnprintf(msg, MORIA_MESSAGE_SIZE, format, args);
+    va_end(args);
+
+    printMessage(msg);
+}
+
 // Print a message so as not to interrupt a counted command. -CJS-
-void printMessageNoCommandInterrupt(const std::string &msg) {
+void printMessageNoCommandInterrupt(const char *msg) {
     // Save command count value
     int i = game.command_count;
 
-    printMessage(msg.c_str());
+    printMessage(msg);
 
     // Restore count value
     game.command_count = i;
@@ -392,7 +446,15 @@ char getKeyInput() {
     game.command_count = 0; // Just to be safe -CJS-
 
     while (true) {
-        int ch = getch();
+        int ch;
+
+        if (!replayReadKey(ch)) {
+            ch = getch();
+
+            if (ch != CTRL_KEY('R')) {
+                replayWriteKey(ch);
+            }
+        }
 
         // some machines may not sign extend.
         if (ch == EOF) {
@@ -436,7 +498,7 @@ char getKeyInput() {
 // Function returns false if <ESCAPE> is input
 bool getCommand(const std::string &prompt, char &command) {
     if (!prompt.empty()) {
-        putStringClearToEOL(prompt, Coord_t{0, 0});
+        putStringClearToEOL(prompt.c_str(), Coord_t{0, 0});
     }
     command = getKeyInput();
 
@@ -532,7 +594,7 @@ bool getInputConfirmation(const std::string &prompt) {
 // Used to verify a choice, with the option of aborting (useful for "drop all items")
 // and with the option of setting the column for displaying the prompt.
 int getInputConfirmationWithAbort(int column, const std::string &prompt) {
-    putStringClearToEOL(prompt, Coord_t{0, column});
+    putStringClearToEOL(prompt.c_str(), Coord_t{0, column});
 
     int y, x;
     getyx(stdscr, y, x);
@@ -582,6 +644,15 @@ void waitForContinueKey(int line_number) {
 // a certain point, sleep for a second. There would need to be a way of resetting
 // the count, with a call made for commands like run or rest.
 bool checkForNonBlockingKeyPress(int microseconds) {
+    // When replaying, the outcome has already been decided.
+    int replayed;
+    if (replayReadKeyPress(replayed)) {
+        if (replayed == 2) {
+            eof_flag++;
+        }
+        return replayed == 1;
+    }
+
 #ifdef _WIN32
     (void) microseconds;
 
@@ -590,6 +661,8 @@ bool checkForNonBlockingKeyPress(int microseconds) {
     int result = getch();
     timeout(-1);
 
+    replayWriteKeyPress(result > 0 ? 1 : 0);
+
     return result > 0;
 #else
     struct timeval tbuf {};
@@ -606,11 +679,14 @@ bool checkForNonBlockingKeyPress(int microseconds) {
         // check for EOF errors here, select sometimes works even when EOF
         if (ch == -1) {
             eof_flag++;
+            replayWriteKeyPress(2);
             return false;
         }
+        replayWriteKeyPress(1);
         return true;
     }
 
+    replayWriteKeyPress(0);
     return false;
 #endif
 }
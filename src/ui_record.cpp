@@ -0,0 +1,455 @@
+// Copyright (c) 1981-86 Robert A. Koeneke
+// Copyright (c) 1987-94 James E. Wilson
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Terminal session recording and playback
+
+#include "headers.h"
+#include "curses.h"
+
+#include <chrono>
+#include <vector>
+
+// The game only ever draws to the first 24 lines and 80 columns of the
+// terminal, so that is all we need to keep track of.
+constexpr uint8_t RECORD_ROWS = 24;
+constexpr uint8_t RECORD_COLS = 80;
+
+// A full screen is written every this many frames so playback can seek
+// without having to replay the whole session.
+constexpr uint16_t RECORD_KEYFRAME_INTERVAL = 256;
+
+// Frame types
+constexpr uint8_t RECORD_FRAME_KEY = 'K';
+constexpr uint8_t RECORD_FRAME_DELTA = 'D';
+
+// type + timestamp + payload length + cursor y/x
+constexpr uint8_t RECORD_FRAME_HEADER_SIZE = 11;
+
+// Maximum size of a frame: a keyframe is always smaller than the worst-case delta.
+constexpr uint32_t RECORD_MAX_FRAME_SIZE = RECORD_FRAME_HEADER_SIZE + 2 + RECORD_ROWS * (3 + RECORD_COLS * 2);
+
+// Frames are collected into this buffer, and only written to disk once it is full.
+constexpr uint32_t RECORD_BUFFER_SIZE = 64 * 1024;
+
+static const char record_magic[] = "UMREC1\n";
+
+// A screen cell holds the character in the low byte, and the color pair in the high byte.
+typedef uint16_t RecordCell_t;
+typedef RecordCell_t RecordScreen_t[RECORD_ROWS][RECORD_COLS];
+
+static struct {
+    FILE *file = nullptr;
+    std::chrono::steady_clock::time_point started_at = {};
+    uint32_t frame_count = 0;
+    Coord_t cursor = Coord_t{-1, -1};
+    RecordScreen_t screen = {};
+    uint8_t buffer[RECORD_BUFFER_SIZE] = {};
+    uint32_t buffer_used = 0;
+} recorder;
+
+static void recordBufferFlush() {
+    if (recorder.buffer_used == 0) {
+        return;
+    }
+
+    if (fwrite(recorder.buffer, 1, recorder.buffer_used, recorder.file) != recorder.buffer_used) {
+        // Something went wrong with the disk, so give up on recording
+        // rather than interrupting the game.
+        (void) fclose(recorder.file);
+        recorder.file = nullptr;
+    }
+
+    recorder.buffer_used = 0;
+}
+
+static void recordByte(uint8_t value) {
+    recorder.buffer[recorder.buffer_used++] = value;
+}
+
+static void recordShort(uint16_t value) {
+    recordByte((uint8_t)(value & 0xFF));
+    recordByte((uint8_t)((value >> 8) & 0xFF));
+}
+
+static void recordLong(uint32_t value) {
+    recordShort((uint16_t)(value & 0xFFFF));
+    recordShort((uint16_t)((value >> 16) & 0xFFFF));
+}
+
+static void recordCell(RecordCell_t cell) {
+    recordByte((uint8_t)(cell & 0xFF));
+    recordByte((uint8_t)(cell >> 8));
+}
+
+// Read a cell from the curses screen buffer.
+static RecordCell_t screenCellAt(int y, int x) {
+    chtype ch = mvinch(y, x);
+    return (RecordCell_t)((ch & A_CHARTEXT) | ((PAIR_NUMBER(ch) & 0xFF) << 8));
+}
+
+// Start recording all screen output to the given file.
+bool recordingStart(const std::string &filename) {
+    recorder.file = fopen(filename.c_str(), "wb");
+    if (recorder.file == nullptr) {
+        return false;
+    }
+
+    recorder.started_at = std::chrono::steady_clock::now();
+    recorder.frame_count = 0;
+    recorder.buffer_used = 0;
+
+    (void) fwrite(record_magic, 1, sizeof(record_magic) - 1, recorder.file);
+    (void) putc(RECORD_ROWS, recorder.file);
+    (void) putc(RECORD_COLS, recorder.file);
+
+    return true;
+}
+
+// Write out anything remaining in the buffer and close the file.
+void recordingStop() {
+    if (recorder.file == nullptr) {
+        return;
+    }
+
+    recordBufferFlush();
+
+    if (recorder.file != nullptr) {
+        (void) fclose(recorder.file);
+        recorder.file = nullptr;
+    }
+}
+
+// Called each time the screen is refreshed. Only the cells which have changed
+// since the previous frame are written, except for the periodic keyframes.
+void recordingCaptureFrame() {
+    if (recorder.file == nullptr) {
+        return;
+    }
+
+    int cursor_y, cursor_x;
+    getyx(stdscr, cursor_y, cursor_x);
+
+    RecordScreen_t current;
+    for (int y = 0; y < RECORD_ROWS; y++) {
+        for (int x = 0; x < RECORD_COLS; x++) {
+            current[y][x] = screenCellAt(y, x);
+        }
+    }
+
+    // mvinch() moves the cursor, so put it back where the game left it
+    (void) move(cursor_y, cursor_x);
+
+    bool keyframe = recorder.frame_count % RECORD_KEYFRAME_INTERVAL == 0;
+
+    if (!keyframe && cursor_y == recorder.cursor.y && cursor_x == recorder.cursor.x && memcmp(current, recorder.screen, sizeof(current)) == 0) {
+        // Nothing to see here
+        return;
+    }
+
+    if (recorder.buffer_used + RECORD_MAX_FRAME_SIZE > RECORD_BUFFER_SIZE) {
+        recordBufferFlush();
+
+        if (recorder.file == nullptr) {
+            return;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - recorder.started_at);
+
+    uint32_t frame_start = recorder.buffer_used;
+
+    recordByte(keyframe ? RECORD_FRAME_KEY : RECORD_FRAME_DELTA);
+    recordLong((uint32_t) elapsed.count());
+    recordLong(0); // payload length, filled in below
+    recordByte((uint8_t) cursor_y);
+    recordByte((uint8_t) cursor_x);
+
+    if (keyframe) {
+        for (auto &row : current) {
+            for (auto cell : row) {
+                recordCell(cell);
+            }
+        }
+    } else {
+        uint32_t runs_at = recorder.buffer_used;
+        uint16_t runs = 0;
+        recordShort(0);
+
+        for (int y = 0; y < RECORD_ROWS; y++) {
+            int x = 0;
+
+            while (x < RECORD_COLS) {
+                if (current[y][x] == recorder.screen[y][x]) {
+                    x++;
+                    continue;
+                }
+
+                int start = x;
+                while (x < RECORD_COLS && current[y][x] != recorder.screen[y][x]) {
+                    x++;
+                }
+
+                recordByte((uint8_t) y);
+                recordByte((uint8_t) start);
+                recordByte((uint8_t)(x - start));
+                for (int i = start; i < x; i++) {
+                    recordCell(current[y][i]);
+                }
+                runs++;
+            }
+        }
+
+        recorder.buffer[runs_at] = (uint8_t)(runs & 0xFF);
+        recorder.buffer[runs_at + 1] = (uint8_t)(runs >> 8);
+    }
+
+    uint32_t payload = recorder.buffer_used - frame_start - RECORD_FRAME_HEADER_SIZE;
+    for (int i = 0; i < 4; i++) {
+        recorder.buffer[frame_start + 5 + i] = (uint8_t)((payload >> (8 * i)) & 0xFF);
+    }
+
+    (void) memcpy(recorder.screen, current, sizeof(current));
+    recorder.cursor = Coord_t{cursor_y, cursor_x};
+    recorder.frame_count++;
+}
+
+//
+// Playback
+//
+
+typedef struct {
+    uint32_t offset;    // Offset of the frame in the recording
+    uint32_t timestamp; // Milliseconds since the start of the recording
+} RecordFrame_t;
+
+static uint32_t readLong(std::vector<uint8_t> const &data, uint32_t offset) {
+    return (uint32_t) data[offset] | ((uint32_t) data[offset + 1] << 8) | ((uint32_t) data[offset + 2] << 16) | ((uint32_t) data[offset + 3] << 24);
+}
+
+// Apply the frame at `offset` to the screen, returning the new cursor position.
+// Nothing is read past the frame's own payload, so a corrupt frame can only
+// leave the screen part drawn.
+static Coord_t playbackApplyFrame(std::vector<uint8_t> const &data, uint32_t offset, RecordScreen_t &screen) {
+    uint8_t type = data[offset];
+    Coord_t cursor = Coord_t{data[offset + 9], data[offset + 10]};
+    uint32_t pos = offset + RECORD_FRAME_HEADER_SIZE;
+    uint32_t end = pos + readLong(data, offset + 5);
+
+    if (type == RECORD_FRAME_KEY) {
+        if (end - pos < RECORD_ROWS * RECORD_COLS * 2) {
+            return cursor;
+        }
+
+        for (auto &row : screen) {
+            for (auto &cell : row) {
+                cell = (RecordCell_t)(data[pos] | (data[pos + 1] << 8));
+                pos += 2;
+            }
+        }
+        return cursor;
+    }
+
+    if (end - pos < 2) {
+        return cursor;
+    }
+
+    uint16_t runs = (uint16_t)(data[pos] | (data[pos + 1] << 8));
+    pos += 2;
+
+    for (int run = 0; run < runs; run++) {
+        if (end - pos < 3) {
+            break;
+        }
+
+        uint8_t y = data[pos];
+        uint8_t x = data[pos + 1];
+        uint8_t length = data[pos + 2];
+        pos += 3;
+
+        if (end - pos < 2u * length) {
+            break;
+        }
+
+        // cells past the edge of the screen are skipped, not drawn
+        for (int i = 0; i < length && y < RECORD_ROWS && x + i < RECORD_COLS; i++) {
+            screen[y][x + i] = (RecordCell_t)(data[pos + 2 * i] | (data[pos + 2 * i + 1] << 8));
+        }
+        pos += 2u * length;
+    }
+
+    return cursor;
+}
+
+static void playbackDrawScreen(RecordScreen_t const &screen, Coord_t cursor) {
+    for (int y = 0; y < RECORD_ROWS; y++) {
+        for (int x = 0; x < RECORD_COLS; x++) {
+            RecordCell_t cell = screen[y][x];
+            int pair = cell >> 8;
+
+            if (pair != 0 && config::options::use_colors) {
+                attron(COLOR_PAIR(pair));
+            }
+            (void) mvaddch(y, x, (chtype)(cell & 0xFF));
+            if (pair != 0 && config::options::use_colors) {
+                attroff(COLOR_PAIR(pair));
+            }
+        }
+    }
+
+    (void) move(cursor.y, cursor.x);
+    (void) refresh();
+}
+
+static void playbackStatus(const char *status) {
+    // Only shown when the terminal has room below the game screen
+    if (LINES <= RECORD_ROWS) {
+        return;
+    }
+    (void) move(LINES - 1, 0);
+    clrtoeol();
+    (void) addstr(status);
+}
+
+// Rebuild the screen for frame `target` starting from the nearest keyframe before it.
+static Coord_t playbackSeek(std::vector<uint8_t> const &data, std::vector<RecordFrame_t> const &frames, size_t target, RecordScreen_t &screen) {
+    size_t start = target - (target % RECORD_KEYFRAME_INTERVAL);
+    Coord_t cursor = Coord_t{0, 0};
+
+    for (size_t i = start; i <= target; i++) {
+        cursor = playbackApplyFrame(data, frames[i].offset, screen);
+    }
+
+    return cursor;
+}
+
+// Play back a recorded session.
+//
+// Keys: `+`/`-` change the playback speed, `<`/`>` jump to the previous/next
+// keyframe, <space> pauses and `q`/<ESCAPE> quits.
+bool recordingPlayback(const std::string &filename) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data.insert(data.end(), chunk, chunk + read);
+    }
+    (void) fclose(file);
+
+    // Frame offsets are 32 bits, so a longer file can't be a recording
+    size_t header_size = sizeof(record_magic) - 1 + 2;
+    if (data.size() < header_size || data.size() > UINT32_MAX || memcmp(data.data(), record_magic, sizeof(record_magic) - 1) != 0) {
+        return false;
+    }
+
+    // Index every frame so we can seek around the recording.
+    std::vector<RecordFrame_t> frames;
+    auto offset = (uint32_t) header_size;
+    while (offset + RECORD_FRAME_HEADER_SIZE <= data.size()) {
+        uint32_t length = readLong(data, offset + 5);
+        if (length > data.size() - offset - RECORD_FRAME_HEADER_SIZE) {
+            break; // truncated recording
+        }
+        frames.push_back(RecordFrame_t{offset, readLong(data, offset + 1)});
+        offset += RECORD_FRAME_HEADER_SIZE + length;
+    }
+
+    if (frames.empty()) {
+        return true;
+    }
+
+    RecordScreen_t screen = {};
+
+    // Speed as a multiplier in quarters, i.e. 4 == real time.
+    int speed = 4;
+    bool paused = false;
+
+    // Long pauses, waiting on the player, are shortened to this many milliseconds.
+    constexpr uint32_t max_idle = 1000;
+
+    (void) clear();
+
+    size_t frame = 0;
+    Coord_t cursor = playbackApplyFrame(data, frames[0].offset, screen);
+
+    while (frame < frames.size()) {
+        playbackDrawScreen(screen, cursor);
+
+        uint32_t delay = 0;
+        if (frame + 1 < frames.size()) {
+            delay = frames[frame + 1].timestamp - frames[frame].timestamp;
+            if (delay > max_idle) {
+                delay = max_idle;
+            }
+            delay = delay * 4 / speed;
+        }
+
+        timeout(paused ? -1 : (int) delay);
+        int key = getch();
+        timeout(-1);
+
+        size_t next = frame + 1;
+
+        switch (key) {
+            case ERR:
+                break;
+            case 'q':
+            case ESCAPE:
+                return true;
+            case ' ':
+                paused = !paused;
+                playbackStatus(paused ? "-- paused --" : "");
+                continue;
+            case '+':
+            case '=':
+                if (speed < 256) {
+                    speed *= 2;
+                }
+                continue;
+            case '-':
+                if (speed > 1) {
+                    speed /= 2;
+                }
+                continue;
+            case '>':
+                next = frame - (frame % RECORD_KEYFRAME_INTERVAL) + RECORD_KEYFRAME_INTERVAL;
+                if (next >= frames.size()) {
+                    next = frames.size() - 1;
+                }
+                cursor = playbackSeek(data, frames, next, screen);
+                frame = next;
+                continue;
+            case '<':
+                next = frame - (frame % RECORD_KEYFRAME_INTERVAL);
+                if (next == frame && next >= RECORD_KEYFRAME_INTERVAL) {
+                    next -= RECORD_KEYFRAME_INTERVAL;
+                }
+                cursor = playbackSeek(data, frames, next, screen);
+                frame = next;
+                continue;
+            default:
+                // any other key skips the remaining delay
+                break;
+        }
+
+        if (paused) {
+            continue;
+        }
+
+        if (next < frames.size()) {
+            cursor = playbackApplyFrame(data, frames[next].offset, screen);
+        }
+        frame = next;
+    }
+
+    playbackStatus("-- end of recording, press any key --");
+    (void) getch();
+
+    return true;
+}